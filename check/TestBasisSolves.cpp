@@ -564,3 +564,65 @@ TEST_CASE("Basis-solves", "[highs_basis_solves]") {
   highs.run();
   REQUIRE(highs.getInfo().simplex_iteration_count == 0);
 }
+
+TEST_CASE("Basis-solves-multi", "[highs_basis_solves]") {
+  std::string filename =
+      std::string(HIGHS_DIR) + "/check/instances/adlittle.mps";
+  Highs highs;
+  if (!dev_run) highs.setOptionValue("output_flag", false);
+  REQUIRE(highs.readModel(filename) == HighsStatus::kOk);
+  const HighsInt num_row = highs.getNumRow();
+  const HighsInt num_rhs = 6;
+  vector<double> rhs(num_rhs * num_row, 0);
+  vector<double> multi_solution(num_rhs * num_row);
+  vector<double> solution(num_row);
+
+  // Before there is an INVERT the batched solves should fail
+  REQUIRE(highs.getBasisSolve(num_rhs, rhs.data(), multi_solution.data()) ==
+          HighsStatus::kError);
+  REQUIRE(highs.getBasisSolve(-1, rhs.data(), multi_solution.data()) ==
+          HighsStatus::kError);
+
+  REQUIRE(highs.run() == HighsStatus::kOk);
+  REQUIRE(highs.getBasisSolve(num_rhs, NULL, multi_solution.data()) ==
+          HighsStatus::kError);
+
+  // Mix unit, sparse and dense RHS so that both sparse and
+  // hyper-sparse solves are batched
+  HighsRandom random;
+  for (HighsInt iRhs = 0; iRhs < num_rhs; iRhs++) {
+    double* vector_rhs = &rhs[iRhs * num_row];
+    if (iRhs < 2) {
+      vector_rhs[random.integer(num_row)] = 1;
+    } else if (iRhs < 4) {
+      for (HighsInt iEl = 0; iEl < 3; iEl++)
+        vector_rhs[random.integer(num_row)] = random.fraction();
+    } else {
+      for (HighsInt iRow = 0; iRow < num_row; iRow++)
+        vector_rhs[iRow] = random.fraction();
+    }
+  }
+  for (HighsInt transpose = 0; transpose < 2; transpose++) {
+    if (transpose) {
+      REQUIRE(highs.getBasisTransposeSolve(num_rhs, rhs.data(),
+                                           multi_solution.data()) ==
+              HighsStatus::kOk);
+    } else {
+      REQUIRE(highs.getBasisSolve(num_rhs, rhs.data(),
+                                  multi_solution.data()) == HighsStatus::kOk);
+    }
+    // The batched solutions should be identical to the single solutions
+    for (HighsInt iRhs = 0; iRhs < num_rhs; iRhs++) {
+      if (transpose) {
+        REQUIRE(highs.getBasisTransposeSolve(&rhs[iRhs * num_row],
+                                             solution.data()) ==
+                HighsStatus::kOk);
+      } else {
+        REQUIRE(highs.getBasisSolve(&rhs[iRhs * num_row], solution.data()) ==
+                HighsStatus::kOk);
+      }
+      for (HighsInt iRow = 0; iRow < num_row; iRow++)
+        REQUIRE(multi_solution[iRhs * num_row + iRow] == solution[iRow]);
+    }
+  }
+}
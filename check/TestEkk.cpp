@@ -92,3 +92,35 @@ TEST_CASE("EkkPrimal-all", "[highs_test_ekk]") {
   ekk_distillation(highs);
   ekk_blending(highs);
 }
+
+TEST_CASE("Ekk-crash", "[highs_test_ekk]") {
+  std::vector<std::string> model_names = {"adlittle", "afiro", "25fv47",
+                                          "shell"};
+  Highs highs;
+  if (!dev_run) highs.setOptionValue("output_flag", false);
+  for (const std::string& model_name : model_names) {
+    std::string model_file =
+        std::string(HIGHS_DIR) + "/check/instances/" + model_name + ".mps";
+    REQUIRE(highs.readModel(model_file) == HighsStatus::kOk);
+    highs.setOptionValue("presolve", kHighsOffString);
+    REQUIRE(highs.run() == HighsStatus::kOk);
+    const double optimal_objective = highs.getInfo().objective_function_value;
+    for (HighsInt crash_strategy = kSimplexCrashStrategyLtssfK;
+         crash_strategy <= kSimplexCrashStrategyBixbyNoNonzeroColCosts;
+         crash_strategy++) {
+      for (HighsInt simplex_strategy :
+           {kSimplexStrategyDual, kSimplexStrategyPrimal}) {
+        highs.clearSolver();
+        highs.setOptionValue("simplex_crash_strategy", crash_strategy);
+        highs.setOptionValue("simplex_strategy", simplex_strategy);
+        REQUIRE(highs.run() == HighsStatus::kOk);
+        REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+        const double objective = highs.getInfo().objective_function_value;
+        REQUIRE(std::fabs(objective - optimal_objective) <=
+                1e-8 * std::max(1.0, std::fabs(optimal_objective)));
+      }
+    }
+    highs.resetOptions();
+    if (!dev_run) highs.setOptionValue("output_flag", false);
+  }
+}
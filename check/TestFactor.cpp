@@ -1,6 +1,7 @@
 #include "HCheckConfig.h"
 #include "Highs.h"
 #include "catch.hpp"
+#include "parallel/HighsParallel.h"
 #include "util/HFactor.h"
 
 const bool dev_run = false;
@@ -179,6 +180,106 @@ TEST_CASE("Factor-get-set-invert", "[highs_test_factor]") {
     REQUIRE(iterate(variable_out[basis_change], variable_in[basis_change]));
 }
 
+// Random square matrix with a unit diagonal and the given density of
+// off-diagonal entries
+HighsSparseMatrix randomMatrix(const HighsInt dim, const double density) {
+  HighsSparseMatrix matrix;
+  matrix.num_col_ = dim;
+  matrix.num_row_ = dim;
+  HighsRandom random;
+  for (HighsInt iCol = 0; iCol < dim; iCol++) {
+    for (HighsInt iRow = 0; iRow < dim; iRow++) {
+      if (iRow == iCol) {
+        matrix.index_.push_back(iRow);
+        matrix.value_.push_back(1.0);
+      } else if (random.fraction() < density) {
+        matrix.index_.push_back(iRow);
+        matrix.value_.push_back(random.fraction() - 0.5);
+      }
+    }
+    matrix.start_.push_back(matrix.index_.size());
+  }
+  return matrix;
+}
+
+TEST_CASE("Factor-parallel-build", "[highs_test_factor]") {
+  // Factorize a random matrix, whose kernel is large enough for its
+  // columns to be eliminated concurrently, and sparse enough for
+  // Markowitz pivoting to be used until fill-in makes it dense,
+  // without and with the task scheduler, and check that the factors
+  // are identical
+  const HighsInt dim = 500;
+  HighsSparseMatrix matrix = randomMatrix(dim, 0.25);
+  std::vector<HighsInt> basic_set_serial(dim);
+  for (HighsInt iCol = 0; iCol < dim; iCol++) basic_set_serial[iCol] = iCol;
+  std::vector<HighsInt> basic_set_parallel = basic_set_serial;
+
+  Highs::resetGlobalScheduler(true);
+  HFactor factor_serial;
+  factor_serial.setup(matrix, basic_set_serial);
+  REQUIRE(factor_serial.build() == 0);
+
+  highs::parallel::initialize_scheduler(2);
+  HFactor factor_parallel;
+  factor_parallel.setup(matrix, basic_set_parallel);
+  REQUIRE(factor_parallel.build() == 0);
+  Highs::resetGlobalScheduler(true);
+
+  REQUIRE(basic_set_serial == basic_set_parallel);
+  const InvertibleRepresentation invert_serial = factor_serial.getInvert();
+  const InvertibleRepresentation invert_parallel = factor_parallel.getInvert();
+  REQUIRE(invert_serial.l_start == invert_parallel.l_start);
+  REQUIRE(invert_serial.l_index == invert_parallel.l_index);
+  REQUIRE(invert_serial.l_value == invert_parallel.l_value);
+  REQUIRE(invert_serial.u_pivot_index == invert_parallel.u_pivot_index);
+  REQUIRE(invert_serial.u_pivot_value == invert_parallel.u_pivot_value);
+  REQUIRE(invert_serial.u_start == invert_parallel.u_start);
+  REQUIRE(invert_serial.u_index == invert_parallel.u_index);
+  REQUIRE(invert_serial.u_value == invert_parallel.u_value);
+}
+
+TEST_CASE("Factor-dense-kernel", "[highs_test_factor]") {
+  // A dense matrix is factorized as a dense kernel. Check the
+  // solution of a system with it, and that the rank deficiency due to
+  // a repeated column is identified
+  const HighsInt dim = 200;
+  HighsSparseMatrix matrix = randomMatrix(dim, 1.0);
+  std::vector<HighsInt> basic_set(dim);
+  for (HighsInt iCol = 0; iCol < dim; iCol++) basic_set[iCol] = iCol;
+  HFactor factor;
+  factor.setup(matrix, basic_set);
+  REQUIRE(factor.build() == 0);
+
+  // Form the right hand side for a known solution, and compare the
+  // solution given by FTRAN, noting that entry iRow of its result is
+  // the value of basic_set[iRow]
+  HighsRandom random;
+  std::vector<double> x(dim);
+  for (HighsInt iCol = 0; iCol < dim; iCol++) x[iCol] = random.fraction();
+  std::vector<double> b(dim, 0);
+  for (HighsInt iCol = 0; iCol < dim; iCol++)
+    for (HighsInt iEl = matrix.start_[iCol]; iEl < matrix.start_[iCol + 1];
+         iEl++)
+      b[matrix.index_[iEl]] += matrix.value_[iEl] * x[iCol];
+  factor.ftranCall(b);
+  double error_norm = 0;
+  for (HighsInt iRow = 0; iRow < dim; iRow++)
+    error_norm = std::max(std::fabs(b[iRow] - x[basic_set[iRow]]), error_norm);
+  REQUIRE(error_norm < 1e-8);
+
+  // Repeat the first column as the last
+  for (HighsInt iEl = matrix.start_[dim - 1]; iEl < matrix.start_[dim];
+       iEl++)
+    matrix.value_[iEl] = 0;
+  for (HighsInt iEl = matrix.start_[0]; iEl < matrix.start_[1]; iEl++)
+    matrix.value_[matrix.start_[dim - 1] + matrix.index_[iEl]] =
+        matrix.value_[iEl];
+  for (HighsInt iCol = 0; iCol < dim; iCol++) basic_set[iCol] = iCol;
+  HFactor singular_factor;
+  singular_factor.setup(matrix, basic_set);
+  REQUIRE(singular_factor.build() == 1);
+}
+
 HighsInt rowOut(const HighsInt variable_out) {
   for (HighsInt iRow = 0; iRow < num_row; iRow++)
     if (basic_set[iRow] == variable_out) return iRow;
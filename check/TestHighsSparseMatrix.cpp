@@ -4,6 +4,7 @@
 #include "HCheckConfig.h"
 #include "Highs.h"
 #include "catch.hpp"
+#include "parallel/HighsParallel.h"
 
 const bool dev_run = false;
 bool infNormDiffOk(const std::vector<double> x0, const std::vector<double> x1) {
@@ -125,3 +126,54 @@ TEST_CASE("Sparse-matrix-products", "[highs_sparse_matrix]") {
     highs.clear();
   }
 }
+
+TEST_CASE("Sparse-matrix-parallel-price", "[highs_sparse_matrix]") {
+  Highs highs;
+  if (!dev_run) highs.setOptionValue("output_flag", false);
+  highs.readModel(std::string(HIGHS_DIR) + "/check/instances/25fv47.mps");
+  HighsSparseMatrix matrix = highs.getLp().a_matrix_;
+  const HighsInt num_col = matrix.num_col_;
+  const HighsInt num_row = matrix.num_row_;
+  HighsRandom random;
+  HVector column;
+  column.setup(num_row);
+  column.clear();
+  for (HighsInt iRow = 0; iRow < num_row; iRow++) {
+    if (random.fraction() < 0.5) continue;
+    column.array[iRow] = random.fraction() - 0.5;
+    column.index[column.count++] = iRow;
+  }
+  const HighsInt num_task = 3;
+  std::vector<HVector> partial_result(num_task);
+  for (HVector& partial : partial_result) partial.setup(num_col);
+  HVector serial_result;
+  HVector parallel_result;
+  serial_result.setup(num_col);
+  parallel_result.setup(num_col);
+  const bool quad_precision = false;
+
+  highs::parallel::initialize_scheduler(num_task);
+  // Column-wise parallel PRICE should be identical to serial PRICE
+  matrix.priceByColumn(quad_precision, serial_result, column);
+  matrix.priceByColumnParallel(parallel_result, column, partial_result);
+  REQUIRE(parallel_result.count == serial_result.count);
+  for (HighsInt iX = 0; iX < serial_result.count; iX++)
+    REQUIRE(parallel_result.index[iX] == serial_result.index[iX]);
+  REQUIRE(parallel_result.array == serial_result.array);
+
+  // Row-wise parallel PRICE sums the partial results in a different
+  // order, so should only be accurate
+  matrix.ensureRowwise();
+  parallel_result.clear();
+  matrix.priceByRowParallel(parallel_result, column, partial_result);
+  Highs::resetGlobalScheduler(true);
+  for (HighsInt iCol = 0; iCol < num_col; iCol++)
+    REQUIRE(std::fabs(parallel_result.array[iCol] -
+                      serial_result.array[iCol]) < 1e-12);
+  for (HighsInt iX = 0; iX < parallel_result.count; iX++)
+    REQUIRE(parallel_result.array[parallel_result.index[iX]] != 0);
+  // The partial results should be zeroed for the next PRICE
+  for (const HVector& partial : partial_result)
+    for (HighsInt iCol = 0; iCol < num_col; iCol++)
+      REQUIRE(partial.array[iCol] == 0);
+}
@@ -309,6 +309,37 @@ TEST_CASE("mip-with-lp-solver", "[highs_lp_solver]") {
   REQUIRE(status == HighsStatus::kOk);
 }
 
+TEST_CASE("LP-solver-concurrent", "[highs_lp_solver]") {
+  Highs highs;
+  highs.setOptionValue("output_flag", dev_run);
+  std::string model_file =
+      std::string(HIGHS_DIR) + "/check/instances/adlittle.mps";
+  REQUIRE(highs.readModel(model_file) == HighsStatus::kOk);
+  REQUIRE(highs.run() == HighsStatus::kOk);
+  const double optimal_objective = highs.getInfo().objective_function_value;
+
+  // Use enough threads for dual simplex, IPX and primal simplex to
+  // race
+  Highs::resetGlobalScheduler(true);
+  highs.setOptionValue("threads", 3);
+  REQUIRE(highs.setOptionValue("solver", kConcurrentString) ==
+          HighsStatus::kOk);
+  highs.setOptionValue("presolve", kHighsOffString);
+  highs.clearSolver();
+  REQUIRE(highs.run() == HighsStatus::kOk);
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+  REQUIRE(highs.getBasis().valid);
+  REQUIRE(std::fabs(highs.getInfo().objective_function_value -
+                    optimal_objective) <
+          1e-6 * std::max(1.0, std::fabs(optimal_objective)));
+
+  // With a basis known, the concurrent solver just uses simplex
+  highs.changeColCost(0, 1.1 * highs.getLp().col_cost_[0]);
+  REQUIRE(highs.run() == HighsStatus::kOk);
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+  Highs::resetGlobalScheduler(true);
+}
+
 TEST_CASE("dual-objective-upper-bound", "[highs_lp_solver]") {
   std::string filename;
   HighsStatus status;
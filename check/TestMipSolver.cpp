@@ -1,7 +1,13 @@
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
 #include "HCheckConfig.h"
 #include "Highs.h"
 #include "SpecialLps.h"
 #include "catch.hpp"
+#include "mip/HighsMipSolverData.h"
 
 const bool dev_run = false;
 const double double_equal_tolerance = 1e-5;
@@ -60,6 +66,514 @@ TEST_CASE("MIP-solution-limit", "[highs_test_mip_solver]") {
   REQUIRE(highs.getModelStatus() == HighsModelStatus::kSolutionLimit);
   highs.setOptionValue("mip_max_improving_sols", kHighsIInf);
   highs.clearSolver();
+
+  // Test for kIterationLimit with mip_max_work_units, and that the
+  // work unit limit stops the solver at the same point every time
+  highs.setOptionValue("mip_max_work_units", 100);
+  highs.run();
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kIterationLimit);
+  const int64_t node_count = highs.getInfo().mip_node_count;
+  const double dual_bound = highs.getInfo().mip_dual_bound;
+  highs.clearSolver();
+  highs.run();
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kIterationLimit);
+  REQUIRE(highs.getInfo().mip_node_count == node_count);
+  REQUIRE(highs.getInfo().mip_dual_bound == dual_bound);
+  highs.setOptionValue("mip_max_work_units", kHighsInf);
+  highs.clearSolver();
+}
+
+TEST_CASE("MIP-estimated-time-limit", "[highs_test_mip_solver]") {
+  std::string filename = std::string(HIGHS_DIR) + "/check/instances/bell5.mps";
+
+  Highs highs;
+  if (!dev_run) highs.setOptionValue("output_flag", false);
+  highs.readModel(filename);
+
+  // Once the tree search gives an estimate of the remaining time, a tiny
+  // limit on it stops the solver before the search is complete. The
+  // estimate needs several samples of the search, so the MIP interrupt
+  // callback checks that it was produced
+  bool estimate_produced = false;
+  auto record_estimate = [&estimate_produced](
+                             int callback_type, const std::string&,
+                             const HighsCallbackDataOut* data_out,
+                             HighsCallbackDataIn*, void*) {
+    if (callback_type == kCallbackMipInterrupt &&
+        data_out->mip_estimated_remaining_time >= 0 &&
+        data_out->mip_estimated_remaining_time < kHighsInf)
+      estimate_produced = true;
+  };
+  highs.setCallback(record_estimate);
+  highs.startCallback(kCallbackMipInterrupt);
+  highs.setOptionValue("presolve", kHighsOffString);
+  highs.setOptionValue("mip_max_estimated_time", 1e-9);
+  highs.run();
+  REQUIRE(estimate_produced);
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kSolutionLimit);
+  REQUIRE(highs.getInfo().mip_node_count > 0);
+}
+
+TEST_CASE("MIP-parallel-strong-branching", "[highs_test_mip_solver]") {
+  std::string filename = std::string(HIGHS_DIR) + "/check/instances/lseu.mps";
+  const double optimal_objective = 1120;
+
+  // With more than one thread, strong branching candidates near the
+  // root are evaluated in parallel, and the result must not depend on
+  // the timing of the threads
+  Highs::resetGlobalScheduler(true);
+  Highs highs;
+  if (!dev_run) highs.setOptionValue("output_flag", false);
+  highs.setOptionValue("threads", 2);
+  highs.readModel(filename);
+  highs.run();
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+  REQUIRE(std::fabs(highs.getInfo().objective_function_value -
+                    optimal_objective) < 1e-6);
+  const int64_t node_count = highs.getInfo().mip_node_count;
+
+  highs.clearSolver();
+  highs.run();
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+  REQUIRE(highs.getInfo().mip_node_count == node_count);
+  Highs::resetGlobalScheduler(true);
+}
+
+TEST_CASE("MIP-alns", "[highs_test_mip_solver]") {
+  std::string filename = std::string(HIGHS_DIR) + "/check/instances/flugpl.mps";
+  const double optimal_objective = 1201500;
+
+  // The neighbourhoods of the adaptive large neighbourhood search only
+  // restrict sub-MIPs, so the optimal objective is unchanged. The numbers
+  // of sub-MIPs that the ALNS solved and of those that improved the
+  // incumbent are reported in the development log, which the logging
+  // callback receives
+  int num_alns_calls = 0;
+  int num_alns_successes = 0;
+  auto count_alns = [&num_alns_calls, &num_alns_successes](
+                        int callback_type, const std::string& message,
+                        const HighsCallbackDataOut*, HighsCallbackDataIn*,
+                        void*) {
+    if (callback_type == kCallbackLogging)
+      std::sscanf(message.c_str(),
+                  "ALNS solved %d sub-MIPs, of which %d improved the "
+                  "incumbent",
+                  &num_alns_calls, &num_alns_successes);
+  };
+  Highs highs;
+  highs.setOptionValue("log_dev_level", kHighsLogDevLevelInfo);
+  highs.setCallback(count_alns);
+  highs.startCallback(kCallbackLogging);
+  highs.readModel(filename);
+  highs.setOptionValue("presolve", kHighsOffString);
+  highs.setOptionValue("mip_heuristic_run_alns", true);
+  highs.setOptionValue("mip_heuristic_effort", 1.0);
+  highs.run();
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+  REQUIRE(std::fabs(highs.getInfo().objective_function_value -
+                    optimal_objective) < 1e-6);
+  REQUIRE(num_alns_calls > 0);
+  REQUIRE(num_alns_successes > 0);
+  REQUIRE(num_alns_successes <= num_alns_calls);
+}
+
+TEST_CASE("MIP-root-racers", "[highs_test_mip_solver]") {
+  std::string filename = std::string(HIGHS_DIR) + "/check/instances/lseu.mps";
+  const double optimal_objective = 1120;
+
+  Highs::resetGlobalScheduler(true);
+  Highs highs;
+  if (!dev_run) highs.setOptionValue("output_flag", false);
+  highs.setOptionValue("threads", 2);
+  highs.setOptionValue("mip_root_racers", 3);
+  highs.readModel(filename);
+  highs.run();
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+  REQUIRE(std::fabs(highs.getInfo().objective_function_value -
+                    optimal_objective) < 1e-6);
+  const int64_t node_count = highs.getInfo().mip_node_count;
+  const HighsInt iteration_count = highs.getInfo().simplex_iteration_count;
+
+  // The racing root nodes are waited for when the root node of the
+  // solver finishes, so the search must be the same for a fixed number
+  // of threads
+  highs.clearSolver();
+  highs.run();
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+  REQUIRE(std::fabs(highs.getInfo().objective_function_value -
+                    optimal_objective) < 1e-6);
+  REQUIRE(highs.getInfo().mip_node_count == node_count);
+  REQUIRE(highs.getInfo().simplex_iteration_count == iteration_count);
+  Highs::resetGlobalScheduler(true);
+}
+
+TEST_CASE("MIP-background-heuristics", "[highs_test_mip_solver]") {
+  std::string filename = std::string(HIGHS_DIR) + "/check/instances/bell5.mps";
+  const double optimal_objective = 8966406.49152;
+
+  // With more than one thread, the sub-MIPs of RENS and RINS in the
+  // tree search run in the background, and their results are used at
+  // the end of the plunge, whenever they finished
+  Highs::resetGlobalScheduler(true);
+  Highs highs;
+  if (!dev_run) highs.setOptionValue("output_flag", false);
+  highs.setOptionValue("threads", 2);
+  highs.readModel(filename);
+  highs.run();
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+  REQUIRE(std::fabs(highs.getInfo().objective_function_value -
+                    optimal_objective) < 1e-6 * optimal_objective);
+  const int64_t node_count = highs.getInfo().mip_node_count;
+
+  highs.clearSolver();
+  highs.run();
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+  REQUIRE(highs.getInfo().mip_node_count == node_count);
+  Highs::resetGlobalScheduler(true);
+}
+
+TEST_CASE("MIP-background-heuristics-retry", "[highs_test_mip_solver]") {
+  std::string filename = std::string(HIGHS_DIR) + "/check/instances/lseu.mps";
+  const double optimal_objective = 1120;
+
+  // When a sub-MIP of RENS/RINS that runs in the background is
+  // infeasible in its root node, the heuristic is repeated with a lower
+  // fixing rate at the end of the plunge, as it is when the sub-MIP is
+  // solved directly. This is seen in the development log, which the
+  // logging callback receives instead of the console
+  HighsInt num_retry = 0;
+  auto count_retry = [&num_retry](int callback_type, const std::string& message,
+                                  const HighsCallbackDataOut*,
+                                  HighsCallbackDataIn*, void*) {
+    if (callback_type == kCallbackLogging &&
+        message.find("repeating the heuristic") != std::string::npos)
+      num_retry++;
+  };
+  Highs::resetGlobalScheduler(true);
+  Highs highs;
+  highs.setOptionValue("log_dev_level", kHighsLogDevLevelInfo);
+  highs.setOptionValue("threads", 2);
+  highs.setCallback(count_retry);
+  highs.startCallback(kCallbackLogging);
+  highs.readModel(filename);
+  highs.run();
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+  REQUIRE(std::fabs(highs.getInfo().objective_function_value -
+                    optimal_objective) < 1e-6);
+  REQUIRE(num_retry > 0);
+  Highs::resetGlobalScheduler(true);
+}
+
+TEST_CASE("MIP-parallel-propagation", "[highs_test_mip_solver]") {
+  // Vertex cover of an odd cycle with enough edges for the propagation
+  // rounds of the domain to be split into tasks
+  const HighsInt num_vertex = 4001;
+  HighsLp lp;
+  lp.num_col_ = num_vertex;
+  lp.num_row_ = num_vertex;
+  lp.col_cost_.assign(num_vertex, 1);
+  lp.col_lower_.assign(num_vertex, 0);
+  lp.col_upper_.assign(num_vertex, 1);
+  lp.row_lower_.assign(num_vertex, 1);
+  lp.row_upper_.assign(num_vertex, inf);
+  lp.integrality_.assign(num_vertex, HighsVarType::kInteger);
+  // Column iCol is in the rows of the edges to its two neighbours
+  lp.a_matrix_.start_.clear();
+  for (HighsInt iCol = 0; iCol < num_vertex; iCol++) {
+    lp.a_matrix_.start_.push_back(2 * iCol);
+    lp.a_matrix_.index_.push_back(iCol == 0 ? 0 : iCol - 1);
+    lp.a_matrix_.index_.push_back(iCol == 0 ? num_vertex - 1 : iCol);
+    lp.a_matrix_.value_.push_back(1);
+    lp.a_matrix_.value_.push_back(1);
+  }
+  lp.a_matrix_.start_.push_back(2 * num_vertex);
+  const double optimal_objective = (num_vertex + 1) / 2;
+
+  Highs::resetGlobalScheduler(true);
+  Highs highs;
+  if (!dev_run) highs.setOptionValue("output_flag", false);
+  highs.setOptionValue("threads", 2);
+  highs.setOptionValue("presolve", kHighsOffString);
+  REQUIRE(highs.passModel(lp) == HighsStatus::kOk);
+  highs.run();
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+  REQUIRE(std::fabs(highs.getInfo().objective_function_value -
+                    optimal_objective) < 1e-6);
+  const int64_t node_count = highs.getInfo().mip_node_count;
+
+  // The bound changes are applied in the order of the rows, so the
+  // solve is reproducible
+  highs.clearSolver();
+  highs.run();
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+  REQUIRE(highs.getInfo().mip_node_count == node_count);
+  Highs::resetGlobalScheduler(true);
+}
+
+TEST_CASE("MIP-parallel-separation", "[highs_test_mip_solver]") {
+  std::string filename = std::string(HIGHS_DIR) + "/check/instances/p0548.mps";
+  const double optimal_objective = 8691;
+
+  // With more than one thread, the separators run concurrently and
+  // their cuts are added to the cut pool in a fixed order
+  Highs::resetGlobalScheduler(true);
+  Highs highs;
+  if (!dev_run) highs.setOptionValue("output_flag", false);
+  highs.setOptionValue("threads", 2);
+  highs.readModel(filename);
+  highs.run();
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+  REQUIRE(std::fabs(highs.getInfo().objective_function_value -
+                    optimal_objective) < 1e-6);
+  const int64_t node_count = highs.getInfo().mip_node_count;
+  const HighsInt simplex_iteration_count =
+      highs.getInfo().simplex_iteration_count;
+
+  highs.clearSolver();
+  highs.run();
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+  REQUIRE(highs.getInfo().mip_node_count == node_count);
+  REQUIRE(highs.getInfo().simplex_iteration_count == simplex_iteration_count);
+  Highs::resetGlobalScheduler(true);
+}
+
+TEST_CASE("MIP-checkpoint", "[highs_test_mip_solver]") {
+  std::string filename = std::string(HIGHS_DIR) + "/check/instances/bell5.mps";
+  const std::string checkpoint_file = "bell5.mipcheckpoint";
+  const double optimal_objective = 8966406.49152;
+  std::remove(checkpoint_file.c_str());
+
+  Highs highs;
+  if (!dev_run) highs.setOptionValue("output_flag", false);
+  highs.readModel(filename);
+  // No MIP solve has stopped with open nodes
+  REQUIRE(highs.writeMipCheckpoint(checkpoint_file) == HighsStatus::kError);
+  REQUIRE(highs.readMipCheckpoint(checkpoint_file) == HighsStatus::kError);
+
+  highs.setOptionValue("mip_max_nodes", 50);
+  highs.run();
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kSolutionLimit);
+  REQUIRE(highs.writeMipCheckpoint(checkpoint_file) == HighsStatus::kOk);
+  const int64_t checkpoint_node_count = highs.getInfo().mip_node_count;
+
+  // A truncated checkpoint, or one whose header states a data size that
+  // does not match the file, is rejected without being read
+  const std::string bad_checkpoint_file = "bell5.bad.mipcheckpoint";
+  std::string checkpoint_data;
+  {
+    std::ifstream in(checkpoint_file, std::ios::binary);
+    checkpoint_data.assign(std::istreambuf_iterator<char>(in),
+                           std::istreambuf_iterator<char>());
+  }
+  {
+    std::ofstream out(bad_checkpoint_file, std::ios::binary);
+    out.write(checkpoint_data.data(), checkpoint_data.size() / 2);
+  }
+  REQUIRE(highs.readMipCheckpoint(bad_checkpoint_file) == HighsStatus::kError);
+  // the data size follows the magic string, the version and the integer size
+  const size_t data_size_offset = sizeof("HiGHS MIP checkpoint") + 8;
+  REQUIRE(checkpoint_data.size() > data_size_offset + sizeof(uint64_t));
+  std::string corrupt_data = checkpoint_data;
+  const uint64_t huge_data_size = uint64_t{1} << 62;
+  std::memcpy(&corrupt_data[data_size_offset], &huge_data_size,
+              sizeof(uint64_t));
+  {
+    std::ofstream out(bad_checkpoint_file, std::ios::binary);
+    out.write(corrupt_data.data(), corrupt_data.size());
+  }
+  REQUIRE(highs.readMipCheckpoint(bad_checkpoint_file) == HighsStatus::kError);
+  std::remove(bad_checkpoint_file.c_str());
+
+  // Resuming the search with the same node limit stops after the first
+  // node, since the node count continues from that of the checkpoint
+  Highs limited;
+  if (!dev_run) limited.setOptionValue("output_flag", false);
+  limited.readModel(filename);
+  limited.setOptionValue("mip_max_nodes", 50);
+  REQUIRE(limited.readMipCheckpoint(checkpoint_file) == HighsStatus::kOk);
+  limited.run();
+  REQUIRE(limited.getModelStatus() == HighsModelStatus::kSolutionLimit);
+  REQUIRE(limited.getInfo().mip_node_count == checkpoint_node_count + 1);
+
+  // Resume the search in a new instance, where the node count includes
+  // the nodes of the interrupted search
+  Highs resumed;
+  if (!dev_run) resumed.setOptionValue("output_flag", false);
+  resumed.readModel(filename);
+  REQUIRE(resumed.readMipCheckpoint(checkpoint_file) == HighsStatus::kOk);
+  resumed.run();
+  REQUIRE(resumed.getModelStatus() == HighsModelStatus::kOptimal);
+  // The search stops at the default relative gap tolerance of 1e-4
+  REQUIRE(std::fabs(resumed.getInfo().objective_function_value -
+                    optimal_objective) < 1e-4 * optimal_objective);
+  REQUIRE(resumed.getInfo().mip_node_count > checkpoint_node_count);
+  // The completed search leaves no checkpoint
+  REQUIRE(resumed.writeMipCheckpoint(checkpoint_file) == HighsStatus::kError);
+
+  std::remove(checkpoint_file.c_str());
+}
+
+TEST_CASE("MIP-incremental-node-switch", "[highs_test_mip_solver]") {
+  std::string filename = std::string(HIGHS_DIR) + "/check/instances/lseu.mps";
+  Highs highs;
+  highs.setOptionValue("output_flag", false);
+  highs::parallel::initialize_scheduler();
+  highs.readModel(filename);
+  const HighsLp& lp = highs.getLp();
+
+  // Set up the MIP solver data up to the global domain of the search
+  HighsOptions options = highs.getOptions();
+  options.presolve = kHighsOffString;
+  HighsCallback callback;
+  callback.clear();
+  HighsSolution solution;
+  HighsMipSolver mipsolver(callback, options, lp, solution);
+  mipsolver.modelstatus_ = HighsModelStatus::kNotset;
+  mipsolver.timer_.start(mipsolver.timer_.solve_clock);
+  mipsolver.improving_solution_file_ = nullptr;
+  mipsolver.mipdata_ = decltype(mipsolver.mipdata_)(
+      new HighsMipSolverData(mipsolver));
+  HighsMipSolverData& mipdata = *mipsolver.mipdata_;
+  mipdata.init();
+  mipdata.runPresolve(options.presolve_reduction_limit);
+  mipdata.runSetup();
+  REQUIRE(mipsolver.modelstatus_ == HighsModelStatus::kNotset);
+  const HighsDomain& globaldom = mipdata.domain;
+
+  // The domain change stack of a node is that of a domain in which the
+  // branchings are made and propagated one after the other
+  struct Node {
+    std::vector<HighsDomainChange> domchgstack;
+    std::vector<HighsInt> branchings;
+  };
+  
+  auto makeNode = [&](const std::vector<HighsDomainChange>& branchings) {
+    HighsDomain dom(globaldom);
+    for (const HighsDomainChange& branching : branchings) {
+      dom.changeBound(branching, HighsDomain::Reason::branching());
+      dom.propagate();
+      REQUIRE(!dom.infeasible());
+    }
+    return Node{dom.getDomainChangeStack(), dom.getBranchingPositions()};
+  };
+  auto up = [](HighsInt col) {
+    return HighsDomainChange{1.0, col, HighsBoundType::kLower};
+  };
+  auto down = [](HighsInt col) {
+    return HighsDomainChange{0.0, col, HighsBoundType::kUpper};
+  };
+  const std::vector<Node> nodes = {
+      makeNode({up(0), down(1), up(2)}),
+      // sibling of the first node
+      makeNode({up(0), down(1), down(2)}),
+      // cousins of the first two nodes
+      makeNode({up(0), up(1), up(3)}),
+      makeNode({up(0), up(1), down(3), up(5)}),
+      // node in the other subtree of the root and the root itself
+      makeNode({down(0), up(4)}),
+      makeNode({}),
+      makeNode({up(0), down(1), up(2)})};
+
+  // Switching between the nodes by backtracking to their common ancestor
+  // must give the same domain as replaying each node from the global domain
+  HighsDomain localdom(globaldom);
+  for (const Node& node : nodes) {
+    localdom.backtrackToCommonAncestor(node.domchgstack, node.branchings);
+    localdom.applyDomainChangeStack(node.domchgstack, node.branchings);
+    HighsDomain replayed(globaldom);
+    replayed.setDomainChangeStack(node.domchgstack, node.branchings);
+    REQUIRE(!localdom.infeasible());
+    REQUIRE(!replayed.infeasible());
+    REQUIRE(localdom.col_lower_ == replayed.col_lower_);
+    REQUIRE(localdom.col_upper_ == replayed.col_upper_);
+    REQUIRE(localdom.getBranchingPositions().size() ==
+            node.branchings.size());
+  }
+}
+
+TEST_CASE("MIP-node-memory-limit", "[highs_test_mip_solver]") {
+  std::string filename = std::string(HIGHS_DIR) + "/check/instances/bell5.mps";
+  const double optimal_objective = 8966406.49152;
+
+  // With a node memory limit of 1KB most open nodes are moved to the
+  // temporary file and read back when they are popped. The numbers of
+  // nodes written and read are reported in the development log, which
+  // the logging callback receives
+  long long num_written = -1;
+  long long num_read = -1;
+  auto count_spills = [&num_written, &num_read](
+                          int callback_type, const std::string& message,
+                          const HighsCallbackDataOut*, HighsCallbackDataIn*,
+                          void*) {
+    if (callback_type == kCallbackLogging)
+      std::sscanf(message.c_str(),
+                  "Node queue wrote %lld open nodes to its temporary file "
+                  "and read %lld back",
+                  &num_written, &num_read);
+  };
+  Highs highs;
+  highs.setOptionValue("log_dev_level", kHighsLogDevLevelInfo);
+  highs.setOptionValue("mip_node_memory_limit", 1e-3);
+  highs.setCallback(count_spills);
+  highs.startCallback(kCallbackLogging);
+  highs.readModel(filename);
+  highs.run();
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+  REQUIRE(std::fabs(highs.getInfo().objective_function_value -
+                    optimal_objective) < 1e-4 * optimal_objective);
+  REQUIRE(num_written > 0);
+  REQUIRE(num_read > 0);
+  REQUIRE(num_read <= num_written);
+}
+
+TEST_CASE("MIP-in-tree-restart", "[highs_test_mip_solver]") {
+  std::string filename = std::string(HIGHS_DIR) + "/check/instances/lseu.mps";
+  const double optimal_objective = 1120;
+
+  // The global bound changes learned in the tree of lseu make enough
+  // integer columns inactive for the search to restart from the root
+  // node. The conflicts that are carried over to the restarted search
+  // are reported in the development log, which the logging callback
+  // receives
+  bool restarted = false;
+  long long num_carried_conflicts = 0;
+  auto count_conflicts = [&restarted, &num_carried_conflicts](
+                             int callback_type, const std::string& message,
+                             const HighsCallbackDataOut*, HighsCallbackDataIn*,
+                             void*) {
+    if (callback_type != kCallbackLogging) return;
+    if (message.find("Restarting search from the root node") !=
+        std::string::npos)
+      restarted = true;
+    long long num_conflicts = 0;
+    if (restarted &&
+        std::sscanf(message.c_str(),
+                    "carrying %lld conflicts over to the restarted search",
+                    &num_conflicts) == 1)
+      num_carried_conflicts += num_conflicts;
+  };
+  Highs highs;
+  highs.setOptionValue("log_dev_level", kHighsLogDevLevelInfo);
+  highs.setCallback(count_conflicts);
+  highs.startCallback(kCallbackLogging);
+  highs.readModel(filename);
+  highs.run();
+  REQUIRE(restarted);
+  REQUIRE(num_carried_conflicts > 0);
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+  REQUIRE(std::fabs(highs.getInfo().objective_function_value -
+                    optimal_objective) < 1e-6 * optimal_objective);
+
+  // Without restarts the optimum is the same
+  Highs no_restart;
+  if (!dev_run) no_restart.setOptionValue("output_flag", false);
+  no_restart.setOptionValue("mip_allow_restart", false);
+  no_restart.readModel(filename);
+  no_restart.run();
+  REQUIRE(no_restart.getModelStatus() == HighsModelStatus::kOptimal);
+  REQUIRE(std::fabs(no_restart.getInfo().objective_function_value -
+                    highs.getInfo().objective_function_value) <
+          1e-6 * optimal_objective);
 }
 
 TEST_CASE("MIP-integrality", "[highs_test_mip_solver]") {
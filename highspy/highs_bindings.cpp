@@ -782,15 +782,23 @@ PYBIND11_MODULE(_highs, m) {
                      &HighsOptions::simplex_permute_strategy)
       .def_readwrite("simplex_price_strategy",
                      &HighsOptions::simplex_price_strategy)
+      .def_readwrite("simplex_price_row_parallel",
+                     &HighsOptions::simplex_price_row_parallel)
       .def_readwrite("mip_detect_symmetry", &HighsOptions::mip_detect_symmetry)
       .def_readwrite("mip_max_nodes", &HighsOptions::mip_max_nodes)
       .def_readwrite("mip_max_stall_nodes", &HighsOptions::mip_max_stall_nodes)
       .def_readwrite("mip_max_leaves", &HighsOptions::mip_max_leaves)
       .def_readwrite("mip_max_improving_sols",
                      &HighsOptions::mip_max_improving_sols)
+      .def_readwrite("mip_max_work_units", &HighsOptions::mip_max_work_units)
+      .def_readwrite("mip_max_estimated_time",
+                     &HighsOptions::mip_max_estimated_time)
+      .def_readwrite("mip_root_racers", &HighsOptions::mip_root_racers)
       .def_readwrite("mip_lp_age_limit", &HighsOptions::mip_lp_age_limit)
       .def_readwrite("mip_pool_age_limit", &HighsOptions::mip_pool_age_limit)
       .def_readwrite("mip_pool_soft_limit", &HighsOptions::mip_pool_soft_limit)
+      .def_readwrite("mip_node_memory_limit",
+                     &HighsOptions::mip_node_memory_limit)
       .def_readwrite("mip_pscost_minreliable",
                      &HighsOptions::mip_pscost_minreliable)
       .def_readwrite("mip_min_cliquetable_entries_for_parallelism",
@@ -802,6 +810,8 @@ PYBIND11_MODULE(_highs, m) {
       .def_readwrite("mip_abs_gap", &HighsOptions::mip_abs_gap)
       .def_readwrite("mip_heuristic_effort",
                      &HighsOptions::mip_heuristic_effort)
+      .def_readwrite("mip_heuristic_run_alns",
+                     &HighsOptions::mip_heuristic_run_alns)
       .def_readwrite("mip_min_logging_interval",
                      &HighsOptions::mip_min_logging_interval);
   py::class_<Highs>(m, "Highs")
@@ -1146,6 +1156,10 @@ PYBIND11_MODULE(_highs, m) {
                      &HighsCallbackDataOut::mip_primal_bound)
       .def_readwrite("mip_dual_bound", &HighsCallbackDataOut::mip_dual_bound)
       .def_readwrite("mip_gap", &HighsCallbackDataOut::mip_gap)
+      .def_readwrite("mip_estimated_nodes",
+                     &HighsCallbackDataOut::mip_estimated_nodes)
+      .def_readwrite("mip_estimated_remaining_time",
+                     &HighsCallbackDataOut::mip_estimated_remaining_time)
       .def_property(
           "mip_solution",
           [](const HighsCallbackDataOut& self) -> py::array {
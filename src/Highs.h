@@ -14,6 +14,7 @@
 #ifndef HIGHS_H_
 #define HIGHS_H_
 
+#include <memory>
 #include <sstream>
 
 #include "lp_data/HighsCallback.h"
@@ -24,6 +25,8 @@
 #include "presolve/ICrash.h"
 #include "presolve/PresolveComponent.h"
 
+struct HighsMipCheckpoint;
+
 /**
  * @brief Return the version
  */
@@ -175,6 +178,12 @@ class Highs {
    */
   HighsStatus readBasis(const std::string& filename);
 
+  /**
+   * @brief Read in a MIP checkpoint that the next MIP solve of the same
+   * model resumes the branch-and-bound search from
+   */
+  HighsStatus readMipCheckpoint(const std::string& filename);
+
   /**
    * @brief Presolve the incumbent model
    */
@@ -558,6 +567,22 @@ class Highs {
                                      HighsInt* solution_num_nz = nullptr,
                                      HighsInt* solution_indices = nullptr);
 
+  /**
+   * @brief Form \f$X=B^{-1}R\f$ for a batch of num_rhs vectors, with
+   * the columns of \f$R\f$ and \f$X\f$ stored consecutively as
+   * vectors of length num_row, sweeping the factors of \f$B\f$ once
+   * for the batch
+   */
+  HighsStatus getBasisSolve(const HighsInt num_rhs, const double* rhs,
+                            double* solution_vectors);
+
+  /**
+   * @brief Form \f$X=B^{-T}R\f$ for a batch of num_rhs vectors, stored
+   * as for getBasisSolve
+   */
+  HighsStatus getBasisTransposeSolve(const HighsInt num_rhs, const double* rhs,
+                                     double* solution_vectors);
+
   /**
    * @brief Form a row of \f$B^{-1}A\f$, returning the indices of the
    * nonzeros unless row_num_nz is nullptr, computing the row using
@@ -759,6 +784,12 @@ class Highs {
    */
   HighsStatus writeBasis(const std::string& filename = "");
 
+  /**
+   * @brief Write out the open nodes, cuts, pseudocosts and incumbent of the
+   * last MIP solve that stopped at a limit before the search was complete
+   */
+  HighsStatus writeMipCheckpoint(const std::string& filename);
+
   /**
    * Methods for incumbent model modification
    */
@@ -1294,6 +1325,7 @@ class Highs {
   HighsRanging ranging_;
 
   std::vector<HighsObjectiveSolution> saved_objective_and_solution_;
+  std::shared_ptr<HighsMipCheckpoint> mip_checkpoint_;
 
   HighsPresolveStatus model_presolve_status_ =
       HighsPresolveStatus::kNotPresolved;
@@ -1452,6 +1484,10 @@ class Highs {
                                   double* solution_vector,
                                   HighsInt* solution_num_nz,
                                   HighsInt* solution_indices, bool transpose);
+  HighsStatus basisSolveMultiInterface(const HighsInt num_rhs,
+                                       const double* rhs,
+                                       double* solution_vectors,
+                                       bool transpose);
 
   HighsStatus setHotStartInterface(const HotStart& hot_start);
 
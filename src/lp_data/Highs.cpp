@@ -27,6 +27,7 @@
 #include "lp_data/HighsInfoDebug.h"
 #include "lp_data/HighsLpSolverObject.h"
 #include "lp_data/HighsSolve.h"
+#include "mip/HighsMipCheckpoint.h"
 #include "mip/HighsMipSolver.h"
 #include "model/HighsHessianUtils.h"
 #include "parallel/HighsParallel.h"
@@ -675,6 +676,20 @@ HighsStatus Highs::readBasis(const std::string& filename) {
   return HighsStatus::kOk;
 }
 
+HighsStatus Highs::readMipCheckpoint(const std::string& filename) {
+  this->logHeader();
+  std::shared_ptr<HighsMipCheckpoint> checkpoint =
+      std::make_shared<HighsMipCheckpoint>();
+  if (!checkpoint->readFromFile(filename)) {
+    highsLogUser(options_.log_options, HighsLogType::kError,
+                 "readMipCheckpoint: cannot read a MIP checkpoint from %s\n",
+                 filename.c_str());
+    return HighsStatus::kError;
+  }
+  mip_checkpoint_ = std::move(checkpoint);
+  return HighsStatus::kOk;
+}
+
 HighsStatus Highs::writeModel(const std::string& filename) {
   HighsStatus return_status = HighsStatus::kOk;
 
@@ -733,6 +748,25 @@ HighsStatus Highs::writeBasis(const std::string& filename) {
   return returnFromHighs(return_status);
 }
 
+HighsStatus Highs::writeMipCheckpoint(const std::string& filename) {
+  if (!mip_checkpoint_) {
+    highsLogUser(options_.log_options, HighsLogType::kError,
+                 "writeMipCheckpoint: no MIP solve has stopped with open "
+                 "nodes\n");
+    return HighsStatus::kError;
+  }
+  highsLogUser(options_.log_options, HighsLogType::kInfo,
+               "Writing the MIP checkpoint with %" HIGHSINT_FORMAT
+               " open nodes to %s\n",
+               mip_checkpoint_->numOpenNodes(), filename.c_str());
+  if (!mip_checkpoint_->writeToFile(filename)) {
+    highsLogUser(options_.log_options, HighsLogType::kError,
+                 "writeMipCheckpoint: cannot write to %s\n", filename.c_str());
+    return HighsStatus::kError;
+  }
+  return HighsStatus::kOk;
+}
+
 HighsStatus Highs::presolve() {
   if (model_.needsMods(options_.infinite_cost)) {
     highsLogUser(options_.log_options, HighsLogType::kError,
@@ -1459,9 +1493,11 @@ HighsStatus Highs::run() {
             HighsOptions save_options = options_;
             const bool full_logging = false;
             if (full_logging) options_.log_dev_level = kHighsLogDevLevelVerbose;
-            // Force the use of simplex to clean up if IPM has been used
-            // to solve the presolved problem
-            if (options_.solver == kIpmString) options_.solver = kSimplexString;
+            // Force the use of simplex to clean up if IPM has (or may
+            // have) been used to solve the presolved problem
+            if (options_.solver == kIpmString ||
+                options_.solver == kConcurrentString)
+              options_.solver = kSimplexString;
             options_.simplex_strategy = kSimplexStrategyChoose;
             // Ensure that the parallel solver isn't used
             options_.simplex_min_concurrency = 1;
@@ -1796,6 +1832,53 @@ HighsStatus Highs::getBasisTransposeSolve(const double* Xrhs,
   return HighsStatus::kOk;
 }
 
+HighsStatus Highs::getBasisSolve(const HighsInt num_rhs, const double* rhs,
+                                double* solution_vectors) {
+  if (num_rhs < 0) {
+    highsLogUser(options_.log_options, HighsLogType::kError,
+                 "getBasisSolve: num_rhs = %d < 0\n", int(num_rhs));
+    return HighsStatus::kError;
+  }
+  if (num_rhs == 0) return HighsStatus::kOk;
+  if (rhs == NULL) {
+    highsLogUser(options_.log_options, HighsLogType::kError,
+                 "getBasisSolve: rhs is NULL\n");
+    return HighsStatus::kError;
+  }
+  if (solution_vectors == NULL) {
+    highsLogUser(options_.log_options, HighsLogType::kError,
+                 "getBasisSolve: solution_vectors is NULL\n");
+    return HighsStatus::kError;
+  }
+  if (!ekk_instance_.status_.has_invert)
+    return invertRequirementError("getBasisSolve");
+  return basisSolveMultiInterface(num_rhs, rhs, solution_vectors, false);
+}
+
+HighsStatus Highs::getBasisTransposeSolve(const HighsInt num_rhs,
+                                          const double* rhs,
+                                          double* solution_vectors) {
+  if (num_rhs < 0) {
+    highsLogUser(options_.log_options, HighsLogType::kError,
+                 "getBasisTransposeSolve: num_rhs = %d < 0\n", int(num_rhs));
+    return HighsStatus::kError;
+  }
+  if (num_rhs == 0) return HighsStatus::kOk;
+  if (rhs == NULL) {
+    highsLogUser(options_.log_options, HighsLogType::kError,
+                 "getBasisTransposeSolve: rhs is NULL\n");
+    return HighsStatus::kError;
+  }
+  if (solution_vectors == NULL) {
+    highsLogUser(options_.log_options, HighsLogType::kError,
+                 "getBasisTransposeSolve: solution_vectors is NULL\n");
+    return HighsStatus::kError;
+  }
+  if (!ekk_instance_.status_.has_invert)
+    return invertRequirementError("getBasisTransposeSolve");
+  return basisSolveMultiInterface(num_rhs, rhs, solution_vectors, true);
+}
+
 HighsStatus Highs::getReducedRow(const HighsInt row, double* row_vector,
                                  HighsInt* row_num_nz, HighsInt* row_indices,
                                  const double* pass_basis_inverse_row_vector) {
@@ -3504,7 +3587,15 @@ HighsStatus Highs::callSolveMip() {
   }
   HighsLp& lp = has_semi_variables ? use_lp : model_.lp_;
   HighsMipSolver solver(callback_, options_, lp, solution_);
+  if (mip_checkpoint_) {
+    if (mip_checkpoint_->matchesModel(lp))
+      solver.checkpointinit = mip_checkpoint_.get();
+    else
+      highsLogUser(options_.log_options, HighsLogType::kWarning,
+                   "MIP checkpoint does not match the model and is ignored\n");
+  }
   solver.run();
+  mip_checkpoint_ = std::move(solver.checkpoint_);
   options_.log_dev_level = log_dev_level;
   // Set the return_status, model status and, for completeness, scaled
   // model status
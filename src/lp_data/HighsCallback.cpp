@@ -26,6 +26,8 @@ void HighsCallback::clearHighsCallbackDataOut() {
   this->data_out.mip_dual_bound = -kHighsInf;
   this->data_out.mip_gap = -1;
   this->data_out.mip_solution = nullptr;
+  this->data_out.mip_estimated_nodes = kHighsInf;
+  this->data_out.mip_estimated_remaining_time = kHighsInf;
 }
 
 void HighsCallback::clearHighsCallbackDataIn() {
@@ -31,6 +31,8 @@ typedef struct {
   double mip_dual_bound;
   double mip_gap;
   double* mip_solution;
+  double mip_estimated_nodes;
+  double mip_estimated_remaining_time;
 } HighsCallbackDataOut;
 
 typedef struct {
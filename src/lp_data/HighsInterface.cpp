@@ -1314,6 +1314,61 @@ HighsStatus Highs::basisSolveInterface(const vector<double>& rhs,
   return HighsStatus::kOk;
 }
 
+HighsStatus Highs::basisSolveMultiInterface(const HighsInt num_rhs,
+                                            const double* rhs,
+                                            double* solution_vectors,
+                                            bool transpose) {
+  HighsLp& lp = model_.lp_;
+  HighsInt num_row = lp.num_row_;
+  if (num_row == 0) return HighsStatus::kOk;
+  assert(ekk_instance_.status_.has_invert);
+  ekk_instance_.setNlaPointersForLpAndScale(lp);
+  assert(!lp.is_moved_);
+  // Set up the solve vectors so that all RHS are solved with one
+  // sweep of the factors
+  std::vector<HVector> solve_vector(num_rhs);
+  std::vector<HVector*> solve_vector_pointer(num_rhs);
+  for (HighsInt iRhs = 0; iRhs < num_rhs; iRhs++) {
+    HVector& vector = solve_vector[iRhs];
+    const double* vector_rhs = &rhs[size_t(iRhs) * num_row];
+    vector.setup(num_row);
+    vector.clear();
+    HighsInt rhs_num_nz = 0;
+    for (HighsInt iRow = 0; iRow < num_row; iRow++) {
+      if (vector_rhs[iRow]) {
+        vector.index[rhs_num_nz++] = iRow;
+        vector.array[iRow] = vector_rhs[iRow];
+      }
+    }
+    vector.count = rhs_num_nz;
+    solve_vector_pointer[iRhs] = &vector;
+  }
+  const std::vector<double> expected_density(num_rhs, 1);
+  if (transpose) {
+    ekk_instance_.btranMulti(solve_vector_pointer, expected_density);
+  } else {
+    ekk_instance_.ftranMulti(solve_vector_pointer, expected_density);
+  }
+  // Extract the solutions
+  for (HighsInt iRhs = 0; iRhs < num_rhs; iRhs++) {
+    const HVector& vector = solve_vector[iRhs];
+    double* solution_vector = &solution_vectors[size_t(iRhs) * num_row];
+    if (vector.count < 0 || vector.count > num_row) {
+      // Solution nonzeros not known
+      for (HighsInt iRow = 0; iRow < num_row; iRow++)
+        solution_vector[iRow] = vector.array[iRow];
+    } else {
+      // Solution nonzeros are known
+      for (HighsInt iRow = 0; iRow < num_row; iRow++) solution_vector[iRow] = 0;
+      for (HighsInt iX = 0; iX < vector.count; iX++) {
+        HighsInt iRow = vector.index[iX];
+        solution_vector[iRow] = vector.array[iRow];
+      }
+    }
+  }
+  return HighsStatus::kOk;
+}
+
 HighsStatus Highs::setHotStartInterface(const HotStart& hot_start) {
   assert(hot_start.valid);
   HighsLp& lp = model_.lp_;
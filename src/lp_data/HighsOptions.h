@@ -257,6 +257,7 @@ void reportOption(FILE* file, const OptionRecordString& option,
 
 const string kSimplexString = "simplex";
 const string kIpmString = "ipm";
+const string kConcurrentString = "concurrent";
 
 const HighsInt kKeepNRowsDeleteRows = -1;
 const HighsInt kKeepNRowsDeleteEntries = 0;
@@ -348,6 +349,7 @@ struct HighsOptionsStruct {
   HighsInt max_dual_simplex_cleanup_level;
   HighsInt max_dual_simplex_phase1_cleanup_level;
   HighsInt simplex_price_strategy;
+  bool simplex_price_row_parallel;
   HighsInt simplex_unscaled_solution_strategy;
   HighsInt presolve_reduction_limit;
   HighsInt restart_presolve_reduction_limit;
@@ -388,9 +390,13 @@ struct HighsOptionsStruct {
   HighsInt mip_max_stall_nodes;
   HighsInt mip_max_leaves;
   HighsInt mip_max_improving_sols;
+  double mip_max_work_units;
+  double mip_max_estimated_time;
+  HighsInt mip_root_racers;
   HighsInt mip_lp_age_limit;
   HighsInt mip_pool_age_limit;
   HighsInt mip_pool_soft_limit;
+  double mip_node_memory_limit;
   HighsInt mip_pscost_minreliable;
   HighsInt mip_min_cliquetable_entries_for_parallelism;
   HighsInt mip_report_level;
@@ -398,6 +404,7 @@ struct HighsOptionsStruct {
   double mip_rel_gap;
   double mip_abs_gap;
   double mip_heuristic_effort;
+  bool mip_heuristic_run_alns;
   double mip_min_logging_interval;
 #ifdef HIGHS_DEBUGSOL
   std::string mip_debug_solution_file;
@@ -476,9 +483,10 @@ class HighsOptions : public HighsOptionsStruct {
 
     record_string = new OptionRecordString(
         kSolverString,
-        "Solver option: \"simplex\", \"choose\" or \"ipm\". If "
-        "\"simplex\"/\"ipm\" is chosen then, for a MIP (QP) the integrality "
-        "constraint (quadratic term) will be ignored",
+        "Solver option: \"simplex\", \"choose\", \"ipm\" or "
+        "\"concurrent\". If \"simplex\"/\"ipm\"/\"concurrent\" is chosen "
+        "then, for a MIP (QP) the integrality constraint (quadratic term) will "
+        "be ignored",
         advanced, &solver, kHighsChooseString);
     records.push_back(record_string);
 
@@ -612,8 +620,12 @@ class HighsOptions : public HighsOptionsStruct {
 
     record_int = new OptionRecordInt(
         "simplex_crash_strategy",
-        "Strategy for simplex crash: off / LTSSF / Bixby (0/1/2)", now_advanced,
-        &simplex_crash_strategy, kSimplexCrashStrategyMin,
+        "Strategy for simplex crash: off / LTSSF by row count / Bixby / LTSSF "
+        "by row priority / LTSF by row count / LTSF by row priority / LTSF "
+        "by row priority (as 5) / Bixby without columns of nonzero cost / "
+        "basic (not implemented) / singularity test (not implemented) "
+        "(0/1/2/3/4/5/6/7/8/9)",
+        now_advanced, &simplex_crash_strategy, kSimplexCrashStrategyMin,
         kSimplexCrashStrategyOff, kSimplexCrashStrategyMax);
     records.push_back(record_int);
 
@@ -817,6 +829,27 @@ class HighsOptions : public HighsOptionsStruct {
         advanced, &mip_max_improving_sols, 1, kHighsIInf, kHighsIInf);
     records.push_back(record_int);
 
+    record_double = new OptionRecordDouble(
+        "mip_max_work_units",
+        "Limit on the deterministic work units (LP iterations, nodes, "
+        "separated cuts and propagated rows) of the MIP solver",
+        advanced, &mip_max_work_units, 0.0, kHighsInf, kHighsInf);
+    records.push_back(record_double);
+
+    record_double = new OptionRecordDouble(
+        "mip_max_estimated_time",
+        "Limit on the estimated remaining time of the tree search to stop the "
+        "MIP solver prematurely",
+        advanced, &mip_max_estimated_time, 0.0, kHighsInf, kHighsInf);
+    records.push_back(record_double);
+
+    record_int = new OptionRecordInt(
+        "mip_root_racers",
+        "Number of additional MIP root node evaluations with different random "
+        "seeds and heuristic settings run concurrently with the root node",
+        advanced, &mip_root_racers, 0, 0, 64);
+    records.push_back(record_int);
+
     record_int = new OptionRecordInt(
         "mip_lp_age_limit",
         "Maximal age of dynamic LP rows before "
@@ -838,6 +871,14 @@ class HighsOptions : public HighsOptionsStruct {
         advanced, &mip_pool_soft_limit, 1, 10000, kHighsIInf);
     records.push_back(record_int);
 
+    record_double = new OptionRecordDouble(
+        "mip_node_memory_limit",
+        "Limit in megabytes on the memory for the domain changes of the open "
+        "nodes in the MIP solver, above which nodes are moved to a temporary "
+        "file",
+        advanced, &mip_node_memory_limit, 0.0, kHighsInf, kHighsInf);
+    records.push_back(record_double);
+
     record_int = new OptionRecordInt(
         "mip_pscost_minreliable",
         "Minimal number of observations before "
@@ -869,6 +910,13 @@ class HighsOptions : public HighsOptionsStruct {
         &mip_heuristic_effort, 0.0, 0.05, 1.0);
     records.push_back(record_double);
 
+    record_bool = new OptionRecordBool(
+        "mip_heuristic_run_alns",
+        "Whether the MIP solver selects the sub-MIP heuristic of each node from "
+        "a portfolio of neighbourhoods by adaptive large neighbourhood search",
+        advanced, &mip_heuristic_run_alns, false);
+    records.push_back(record_bool);
+
     record_double = new OptionRecordDouble(
         "mip_rel_gap",
         "Tolerance on relative gap, |ub-lb|/|ub|, to determine whether "
@@ -1001,6 +1049,13 @@ class HighsOptions : public HighsOptionsStruct {
         kSimplexPriceStrategyRowSwitchColSwitch, kSimplexPriceStrategyMax);
     records.push_back(record_int);
 
+    record_bool = new OptionRecordBool(
+        "simplex_price_row_parallel",
+        "Perform row-wise PRICE in parallel, so that the simplex iterations "
+        "depend on the number of threads",
+        advanced, &simplex_price_row_parallel, false);
+    records.push_back(record_bool);
+
     record_int =
         new OptionRecordInt("simplex_unscaled_solution_strategy",
                             "Strategy for solving unscaled LP in simplex",
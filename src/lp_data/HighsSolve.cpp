@@ -12,8 +12,12 @@
  * @brief Class-independent utilities for HiGHS
  */
 
+#include <atomic>
+#include <memory>
+
 #include "ipm/IpxWrapper.h"
 #include "lp_data/HighsSolutionDebug.h"
+#include "parallel/HighsParallel.h"
 #include "simplex/HApp.h"
 
 // The method below runs simplex or ipx solver on the lp.
@@ -105,6 +109,17 @@ HighsStatus solveLp(HighsLpSolverObject& solver_object, const string message) {
         }
       }  // options.run_crossover == kHighsOnString
     }    // unwelcome_ipx_status
+  } else if (options.solver == kConcurrentString) {
+    // Race the simplex solvers and IPX
+    call_status = solveLpConcurrent(solver_object);
+    return_status = interpretCallStatus(options.log_options, call_status,
+                                        return_status, "solveLpConcurrent");
+    if (return_status == HighsStatus::kError) return return_status;
+    if (!isSolutionRightSize(solver_object.lp_, solver_object.solution_)) {
+      highsLogUser(options.log_options, HighsLogType::kError,
+                   "Inconsistent solution returned from solver\n");
+      return HighsStatus::kError;
+    }
   } else {
     // Use Simplex
     call_status = solveLpSimplex(solver_object);
@@ -124,6 +139,186 @@ HighsStatus solveLp(HighsLpSolverObject& solver_object, const string message) {
   return return_status;
 }
 
+namespace {
+// Private copy of the incumbent LP data, allowing a solver to race
+// against the solve of the incumbent LP without sharing any mutable
+// data with it
+struct ConcurrentLpSolve {
+  HighsLp lp;
+  HighsBasis basis;
+  HighsSolution solution;
+  HighsInfo highs_info;
+  HEkk ekk_instance;
+  HighsCallback callback;
+  HighsOptions options;
+  HighsTimer timer;
+  HighsLpSolverObject solver_object;
+  HighsStatus return_status = HighsStatus::kError;
+
+  ConcurrentLpSolve(const HighsLpSolverObject& incumbent)
+      : lp(incumbent.lp_),
+        highs_info(incumbent.highs_info_),
+        options(incumbent.options_),
+        timer(incumbent.timer_),
+        solver_object(lp, basis, solution, highs_info, ekk_instance, callback,
+                      options, timer) {
+    // Only the solve of the incumbent LP logs its progress
+    options.output_flag = false;
+    callback.clear();
+  }
+};
+}  // namespace
+
+// Races dual simplex on the incumbent LP against IPX (with crossover)
+// and, if there are enough threads, primal simplex, each on a copy of
+// the LP. The first solver to reach a conclusive model status wins,
+// and the others are stopped by their interrupt checks
+HighsStatus solveLpConcurrent(HighsLpSolverObject& solver_object) {
+  HighsOptions& options = solver_object.options_;
+  const HighsInt num_threads = highs::parallel::num_threads();
+  // Simplex exploits any known basis, and there is nothing to race
+  // against without a second thread
+  const bool have_basis = solver_object.basis_.valid ||
+                          solver_object.ekk_instance_.status_.has_basis;
+  if (num_threads < 2 || have_basis) {
+    highsLogDev(options.log_options, HighsLogType::kInfo,
+                "Concurrent LP solve uses simplex since %s\n",
+                have_basis ? "a basis is known" : "there is only one thread");
+    return solveLpSimplex(solver_object);
+  }
+  const bool race_primal = num_threads > 2;
+  highsLogUser(options.log_options, HighsLogType::kInfo,
+               "Concurrent LP solve: dual simplex%s racing IPX\n",
+               race_primal ? " and primal simplex" : "");
+
+  // Solver 0 is dual simplex on the incumbent LP, solver 1 is IPX and
+  // solver 2 is primal simplex
+  const HighsInt kDualSolver = 0;
+  const HighsInt kIpxSolver = 1;
+  const HighsInt kPrimalSolver = 2;
+  std::atomic<HighsInt> winner{-1};
+  auto conclusive = [&](const HighsModelStatus model_status) {
+    return model_status == HighsModelStatus::kOptimal ||
+           model_status == HighsModelStatus::kInfeasible ||
+           model_status == HighsModelStatus::kUnbounded ||
+           model_status == HighsModelStatus::kObjectiveBound ||
+           model_status == HighsModelStatus::kObjectiveTarget ||
+           (model_status == HighsModelStatus::kUnboundedOrInfeasible &&
+            options.allow_unbounded_or_infeasible);
+  };
+  auto claimWin = [&](const HighsInt solver, const HighsStatus return_status,
+                      const HighsModelStatus model_status) {
+    if (return_status == HighsStatus::kError || !conclusive(model_status))
+      return;
+    HighsInt no_winner = -1;
+    winner.compare_exchange_strong(no_winner, solver);
+  };
+  auto raceLost = [&](const HighsInt solver) {
+    const HighsInt race_winner = winner.load(std::memory_order_relaxed);
+    return race_winner != -1 && race_winner != solver;
+  };
+
+  ConcurrentLpSolve ipx_solve(solver_object);
+  // Without crossover IPX has no basis to offer
+  ipx_solve.options.run_crossover = kHighsOnString;
+  ipx_solve.callback.user_callback =
+      [&](int, const std::string&, const HighsCallbackDataOut*,
+          HighsCallbackDataIn* data_in,
+          void*) { data_in->user_interrupt = raceLost(kIpxSolver); };
+  ipx_solve.callback.active[kCallbackIpmInterrupt] = true;
+
+  std::unique_ptr<ConcurrentLpSolve> primal_solve;
+  if (race_primal) {
+    primal_solve.reset(new ConcurrentLpSolve(solver_object));
+    primal_solve->options.simplex_strategy = kSimplexStrategyPrimal;
+    primal_solve->callback.user_callback =
+        [&](int, const std::string&, const HighsCallbackDataOut*,
+            HighsCallbackDataIn* data_in,
+            void*) { data_in->user_interrupt = raceLost(kPrimalSolver); };
+    primal_solve->callback.active[kCallbackSimplexInterrupt] = true;
+  }
+
+  // The dual simplex solver on the incumbent LP also has to respond to
+  // any simplex interrupt callback of the user, so wrap it
+  HighsCallback& callback = solver_object.callback_;
+  const HighsCallback user_callback = callback;
+  callback.active.resize(kNumCallbackType, false);
+  callback.user_callback =
+      [&](int callback_type, const std::string& message,
+          const HighsCallbackDataOut* data_out, HighsCallbackDataIn* data_in,
+          void* user_callback_data) {
+        data_in->user_interrupt = raceLost(kDualSolver);
+        if (data_in->user_interrupt) return;
+        if (callback_type < HighsInt(user_callback.active.size()) &&
+            user_callback.active[callback_type] && user_callback.user_callback)
+          user_callback.user_callback(callback_type, message, data_out,
+                                      data_in, user_callback_data);
+      };
+  callback.active[kCallbackSimplexInterrupt] = true;
+
+  HighsStatus dual_return_status;
+  {
+    highs::parallel::TaskGroup tg;
+    tg.spawn([&]() {
+      // If the race is over before the task is started, there is
+      // nothing to do
+      if (raceLost(kIpxSolver)) return;
+      try {
+        ipx_solve.return_status = solveLpIpx(ipx_solve.solver_object);
+      } catch (const std::exception&) {
+        ipx_solve.return_status = HighsStatus::kError;
+      }
+      claimWin(kIpxSolver, ipx_solve.return_status,
+               ipx_solve.solver_object.model_status_);
+    });
+    if (race_primal)
+      tg.spawn([&]() {
+        if (raceLost(kPrimalSolver)) return;
+        primal_solve->return_status =
+            solveLpSimplex(primal_solve->solver_object);
+        claimWin(kPrimalSolver, primal_solve->return_status,
+                 primal_solve->solver_object.model_status_);
+      });
+
+    dual_return_status = solveLpSimplex(solver_object);
+    claimWin(kDualSolver, dual_return_status, solver_object.model_status_);
+    tg.taskWait();
+  }
+  callback = user_callback;
+
+  const HighsInt race_winner = winner.load(std::memory_order_relaxed);
+  ConcurrentLpSolve* winning_solve = nullptr;
+  if (race_winner == kIpxSolver)
+    winning_solve = &ipx_solve;
+  else if (race_winner == kPrimalSolver)
+    winning_solve = primal_solve.get();
+  const std::string winner_name =
+      race_winner == kIpxSolver
+          ? "IPX"
+          : race_winner == kPrimalSolver ? "primal simplex" : "dual simplex";
+  highsLogUser(options.log_options, HighsLogType::kInfo,
+               "Concurrent LP solve %s %s\n",
+               race_winner == -1 ? "inconclusive, using" : "won by",
+               winner_name.c_str());
+  if (!winning_solve) return dual_return_status;
+
+  // Take the solution and basis from the winner. The HEkk instance of
+  // the incumbent LP corresponds to the interrupted dual simplex solve,
+  // so its basis is invalidated
+  solver_object.basis_ = std::move(winning_solve->basis);
+  solver_object.solution_ = std::move(winning_solve->solution);
+  solver_object.highs_info_ = winning_solve->highs_info;
+  solver_object.model_status_ = winning_solve->solver_object.model_status_;
+  solver_object.ekk_instance_.updateStatus(LpAction::kNewBasis);
+  if (race_winner == kIpxSolver) {
+    solver_object.highs_info_.objective_function_value =
+        solver_object.lp_.objectiveValue(solver_object.solution_.col_value);
+    getLpKktFailures(options, solver_object.lp_, solver_object.solution_,
+                     solver_object.basis_, solver_object.highs_info_);
+  }
+  return winning_solve->return_status;
+}
+
 // Solves an unconstrained LP without scaling, setting HighsBasis, HighsSolution
 // and HighsInfo
 HighsStatus solveUnconstrainedLp(HighsLpSolverObject& solver_object) {
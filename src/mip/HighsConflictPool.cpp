@@ -15,7 +15,7 @@
 
 void HighsConflictPool::addConflictCut(
     const HighsDomain& domain,
-    const std::set<HighsDomain::ConflictSet::LocalDomChg>& reasonSideFrontier) {
+    const HighsDomain::ConflictSet::Frontier& reasonSideFrontier) {
   HighsInt conflictIndex;
   HighsInt start;
   HighsInt end;
@@ -85,8 +85,7 @@ void HighsConflictPool::addConflictCut(
 
 void HighsConflictPool::addReconvergenceCut(
     const HighsDomain& domain,
-    const std::set<HighsDomain::ConflictSet::LocalDomChg>&
-        reconvergenceFrontier,
+    const HighsDomain::ConflictSet::Frontier& reconvergenceFrontier,
     const HighsDomainChange& reconvergenceDomchg) {
   HighsInt conflictIndex;
   HighsInt start;
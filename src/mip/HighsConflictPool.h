@@ -52,14 +52,13 @@ class HighsConflictPool {
     ageDistribution_.resize(agelim_ + 1);
   }
 
-  void addConflictCut(const HighsDomain& domain,
-                      const std::set<HighsDomain::ConflictSet::LocalDomChg>&
-                          reasonSideFrontier);
+  void addConflictCut(
+      const HighsDomain& domain,
+      const HighsDomain::ConflictSet::Frontier& reasonSideFrontier);
 
   void addReconvergenceCut(
       const HighsDomain& domain,
-      const std::set<HighsDomain::ConflictSet::LocalDomChg>&
-          reconvergenceFrontier,
+      const HighsDomain::ConflictSet::Frontier& reconvergenceFrontier,
       const HighsDomainChange& reconvergenceDomchg);
 
   void removeConflict(HighsInt conflict);
@@ -49,7 +49,7 @@ static void printCut(const HighsInt* Rindex, const double* Rvalue, HighsInt Rlen
 
 bool HighsCutPool::isDuplicate(size_t hash, double norm, const HighsInt* Rindex,
                                const double* Rvalue, HighsInt Rlen,
-                               double rhs) {
+                               double rhs) const {
   auto range = hashToCutMap.equal_range(hash);
   const double* ARvalue = matrix_.getARvalue();
   const HighsInt* ARindex = matrix_.getARindex();
@@ -434,7 +434,10 @@ HighsInt HighsCutPool::addCut(const HighsMipSolver& mipsolver, HighsInt* Rindex,
   uint64_t h = compute_cut_hash(Rindex, Rvalue, maxabscoef, Rlen);
   double normalization = 1.0 / double(sqrt(norm));
 
-  if (isDuplicate(h, normalization, Rindex, Rvalue, Rlen, rhs)) return -1;
+  if (isDuplicate(h, normalization, Rindex, Rvalue, Rlen, rhs) ||
+      (sharedPool != nullptr &&
+       sharedPool->isDuplicate(h, normalization, Rindex, Rvalue, Rlen, rhs)))
+    return -1;
 
   // if (Rlen > 0.15 * matrix_.numCols())
   //   printf("cut with len %d not propagated\n", Rlen);
@@ -527,3 +530,31 @@ HighsInt HighsCutPool::addCut(const HighsMipSolver& mipsolver, HighsInt* Rindex,
 
   return rowindex;
 }
+
+HighsInt HighsCutPool::addCutsFrom(const HighsMipSolver& mipsolver,
+                                   const HighsCutPool& cutpool) {
+  assert(cutpool.propagationDomains.empty());
+  HighsInt numAddedCuts = 0;
+  std::vector<HighsInt> inds;
+  std::vector<double> vals;
+
+  HighsInt numRows = cutpool.matrix_.getNumRows();
+  for (HighsInt i = 0; i != numRows; ++i) {
+    // the cuts of a private pool of a separator are never in the LP, so a
+    // negative age means that the cut was deleted
+    if (cutpool.ages_[i] < 0) continue;
+
+    HighsInt len;
+    const HighsInt* cutinds;
+    const double* cutvals;
+    cutpool.getCut(i, len, cutinds, cutvals);
+    inds.assign(cutinds, cutinds + len);
+    vals.assign(cutvals, cutvals + len);
+
+    if (addCut(mipsolver, inds.data(), vals.data(), len, cutpool.rhs_[i],
+               cutpool.cutIsIntegral(i)) != -1)
+      ++numAddedCuts;
+  }
+
+  return numAddedCuts;
+}
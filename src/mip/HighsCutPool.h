@@ -74,18 +74,26 @@ class HighsCutPool {
   HighsInt numPropRows;
   std::vector<HighsInt> ageDistribution;
   std::vector<std::pair<HighsInt, double>> sortBuffer;
+  const HighsCutPool* sharedPool;
 
   bool isDuplicate(size_t hash, double norm, const HighsInt* Rindex,
-                   const double* Rvalue, HighsInt Rlen, double rhs);
+                   const double* Rvalue, HighsInt Rlen, double rhs) const;
 
  public:
-  HighsCutPool(HighsInt ncols, HighsInt agelim, HighsInt softlimit)
+  /// when a shared pool is given, cuts that are duplicates of cuts in the
+  /// shared pool are rejected. This allows separators running concurrently to
+  /// collect their cuts in separate pools while only reading the shared pool,
+  /// which must not be modified until the cuts are moved into it with
+  /// addCutsFrom()
+  HighsCutPool(HighsInt ncols, HighsInt agelim, HighsInt softlimit,
+               const HighsCutPool* sharedPool = nullptr)
       : matrix_(ncols),
         agelim_(agelim),
         softlimit_(softlimit),
         numLpCuts(0),
         numPropNzs(0),
-        numPropRows(0) {
+        numPropRows(0),
+        sharedPool(sharedPool) {
     ageDistribution.resize(agelim_ + 1);
     minScoreFactor = 0.9;
     bestObservedScore = 0.0;
@@ -155,6 +163,12 @@ class HighsCutPool {
                   bool integral = false, bool propagate = true,
                   bool extractCliques = true, bool isConflict = false);
 
+  /// adds the cuts collected in the given pool in the order in which they were
+  /// added to it and skips the duplicates of cuts in this pool. Returns the
+  /// number of added cuts
+  HighsInt addCutsFrom(const HighsMipSolver& mipsolver,
+                       const HighsCutPool& cutpool);
+
   HighsInt getRowLength(HighsInt row) const {
     return matrix_.getRowEnd(row) - matrix_.getRowStart(row);
   }
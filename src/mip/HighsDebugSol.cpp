@@ -245,7 +245,7 @@ void HighsDebugSol::checkVlb(HighsInt col, HighsInt vlbcol, double vlbcoef,
 }
 
 void HighsDebugSol::checkConflictReasonFrontier(
-    const std::set<HighsDomain::ConflictSet::LocalDomChg>& reasonSideFrontier,
+    const HighsDomain::ConflictSet::Frontier& reasonSideFrontier,
     const std::vector<HighsDomainChange>& domchgstack) const {
   if (!debugSolActive) return;
 
@@ -269,8 +269,7 @@ void HighsDebugSol::checkConflictReasonFrontier(
 }
 
 void HighsDebugSol::checkConflictReconvergenceFrontier(
-    const std::set<HighsDomain::ConflictSet::LocalDomChg>&
-        reconvergenceFrontier,
+    const HighsDomain::ConflictSet::Frontier& reconvergenceFrontier,
     const HighsDomain::ConflictSet::LocalDomChg& reconvDomchg,
     const std::vector<HighsDomainChange>& domchgstack) const {
   if (!debugSolActive) return;
@@ -18,8 +18,36 @@
 #include "mip/HighsConflictPool.h"
 #include "mip/HighsCutPool.h"
 #include "mip/HighsMipSolverData.h"
+#include "parallel/HighsParallel.h"
 #include "pdqsort/pdqsort.h"
 
+// minimal number of rows or cuts in a propagation round for which the bound
+// changes are computed in parallel, and the number of rows per task
+constexpr HighsInt kMinRowsForParallelPropagation = 2000;
+constexpr HighsInt kParallelPropagationGrainSize = 500;
+
+// number of bound changes that one conflict analysis may explain by their
+// reasons, as a constant part plus a part per integral column
+constexpr HighsInt kConflictResolveBudget = 1000;
+constexpr HighsInt kConflictResolveBudgetPerCol = 2;
+
+// The bound changes of each row only depend on the current domain and are
+// written into the row's own section of the bound change buffer, so for large
+// propagation rounds they are computed in parallel
+template <typename F>
+static void computeBoundChanges(bool parallel, HighsInt numproprows,
+                                F&& propagateIndex) {
+  if (parallel && numproprows >= kMinRowsForParallelPropagation)
+    highs::parallel::for_each(
+        0, numproprows,
+        [&](HighsInt start, HighsInt end) {
+          for (HighsInt k = start; k < end; ++k) propagateIndex(k);
+        },
+        kParallelPropagationGrainSize);
+  else
+    for (HighsInt k = 0; k != numproprows; ++k) propagateIndex(k);
+}
+
 static double activityContributionMin(double coef, const double& lb,
                                       const double& ub) {
   if (coef < 0) {
@@ -1357,6 +1385,49 @@ void HighsDomain::computeMaxActivity(HighsInt start, HighsInt end,
   }
 }
 
+void HighsDomain::computeActivities(HighsInt start, HighsInt end,
+                                    const HighsInt* ARindex,
+                                    const double* ARvalue, HighsInt& ninfmin,
+                                    HighsCDouble& activitymin,
+                                    HighsInt& ninfmax,
+                                    HighsCDouble& activitymax) {
+  if (infeasible_) {
+    computeMinActivity(start, end, ARindex, ARvalue, ninfmin, activitymin);
+    computeMaxActivity(start, end, ARindex, ARvalue, ninfmax, activitymax);
+    return;
+  }
+
+  activitymin = 0.0;
+  activitymax = 0.0;
+  ninfmin = 0;
+  ninfmax = 0;
+  for (HighsInt j = start; j != end; ++j) {
+    HighsInt col = ARindex[j];
+    double val = ARvalue[j];
+
+    assert(col < int(col_lower_.size()));
+
+    double lb = col_lower_[col];
+    double ub = col_upper_[col];
+
+    double contributionmin = activityContributionMin(val, lb, ub);
+    double contributionmax = activityContributionMax(val, lb, ub);
+
+    if (contributionmin == -kHighsInf)
+      ++ninfmin;
+    else
+      activitymin += contributionmin;
+
+    if (contributionmax == kHighsInf)
+      ++ninfmax;
+    else
+      activitymax += contributionmax;
+  }
+
+  activitymin.renormalize();
+  activitymax.renormalize();
+}
+
 double HighsDomain::adjustedUb(HighsInt col, HighsCDouble boundVal,
                                bool& accept) const {
   double bound;
@@ -1976,19 +2047,32 @@ void HighsDomain::computeRowActivities() {
   propagateflags_.resize(mipsolver->numRow());
   propagateinds_.reserve(mipsolver->numRow());
 
-  for (HighsInt i = 0; i != mipsolver->numRow(); ++i) {
-    HighsInt start = mipsolver->mipdata_->ARstart_[i];
-    HighsInt end = mipsolver->mipdata_->ARstart_[i + 1];
+  // the minimal and maximal activities of each row are computed in one pass
+  // over its entries, and the capacity threshold in a second one; both only
+  // depend on the column bounds and are written into the row's own entries,
+  // so for large models the rows are processed in parallel
+  auto computeRowRange = [&](HighsInt rowStart, HighsInt rowEnd) {
+    for (HighsInt i = rowStart; i < rowEnd; ++i) {
+      HighsInt start = mipsolver->mipdata_->ARstart_[i];
+      HighsInt end = mipsolver->mipdata_->ARstart_[i + 1];
 
-    computeMinActivity(start, end, mipsolver->mipdata_->ARindex_.data(),
-                       mipsolver->mipdata_->ARvalue_.data(), activitymininf_[i],
-                       activitymin_[i]);
-    computeMaxActivity(start, end, mipsolver->mipdata_->ARindex_.data(),
-                       mipsolver->mipdata_->ARvalue_.data(), activitymaxinf_[i],
-                       activitymax_[i]);
+      computeActivities(start, end, mipsolver->mipdata_->ARindex_.data(),
+                        mipsolver->mipdata_->ARvalue_.data(),
+                        activitymininf_[i], activitymin_[i],
+                        activitymaxinf_[i], activitymax_[i]);
 
-    recomputeCapacityThreshold(i);
+      recomputeCapacityThreshold(i);
+    }
+  };
+
+  if (highs::parallel::num_threads() > 1 &&
+      mipsolver->numRow() >= kMinRowsForParallelPropagation)
+    highs::parallel::for_each(0, mipsolver->numRow(), computeRowRange,
+                              kParallelPropagationGrainSize);
+  else
+    computeRowRange(0, mipsolver->numRow());
 
+  for (HighsInt i = 0; i != mipsolver->numRow(); ++i) {
     if ((activitymininf_[i] <= 1 && mipsolver->rowUpper(i) != kHighsInf) ||
         (activitymaxinf_[i] <= 1 && mipsolver->rowLower(i) != -kHighsInf)) {
       markPropagate(i);
@@ -2161,6 +2245,36 @@ void HighsDomain::setDomainChangeStack(
   domchgstack_.clear();
   domchgreason_.clear();
   branchPos_.clear();
+  applyDomainChangeStack(domchgstack, branchingPositions);
+}
+
+HighsInt HighsDomain::backtrackToCommonAncestor(
+    const std::vector<HighsDomainChange>& domchgstack,
+    const std::vector<HighsInt>& branchingPositions) {
+  HighsInt numCommon = 0;
+  if (!infeasible_) {
+    HighsInt maxCommon =
+        std::min(branchPos_.size(), branchingPositions.size());
+    while (numCommon < maxCommon &&
+           domchgstack_[branchPos_[numCommon]] ==
+               domchgstack[branchingPositions[numCommon]])
+      ++numCommon;
+  }
+
+  if (numCommon == 0) {
+    backtrackToGlobal();
+    mipsolver->mipdata_->debugSolution.resetDomain(*this);
+    return 0;
+  }
+
+  while ((HighsInt)branchPos_.size() > numCommon) backtrack();
+
+  return numCommon;
+}
+
+void HighsDomain::applyDomainChangeStack(
+    const std::vector<HighsDomainChange>& domchgstack,
+    const std::vector<HighsInt>& branchingPositions) {
   HighsInt stacksize = domchgstack.size();
   HighsInt k = 0;
   for (HighsInt branchPos : branchingPositions) {
@@ -2385,6 +2499,10 @@ bool HighsDomain::propagate() {
   std::unique_ptr<HighsDomainChange[]> changedbounds(
       new HighsDomainChange[changedboundsize]);
 
+  // the bound changes are applied in the order of the rows after they have
+  // been computed, hence the result does not depend on the number of threads
+  const bool parallelPropagation = highs::parallel::num_threads() > 1;
+
   while (havePropagationRows()) {
     if (objProp_.isActive()) objProp_.propagate();
 
@@ -2461,7 +2579,8 @@ bool HighsDomain::propagate() {
 
         // printf("numproprows (model): %" HIGHSINT_FORMAT "\n", numproprows);
 
-        for (HighsInt k = 0; k != numproprows; ++k) propagateIndex(k);
+        computeBoundChanges(parallelPropagation, numproprows, propagateIndex);
+        mipsolver->mipdata_->num_propagated_rows += numproprows;
 
         for (HighsInt k = 0; k != numproprows; ++k) {
           HighsInt i = propagateinds[k];
@@ -2527,7 +2646,8 @@ bool HighsDomain::propagate() {
 
           // printf("numproprows (cuts): %" HIGHSINT_FORMAT "\n", numproprows);
 
-          for (HighsInt k = 0; k != numproprows; ++k) propagateIndex(k);
+          computeBoundChanges(parallelPropagation, numproprows, propagateIndex);
+          mipsolver->mipdata_->num_propagated_rows += numproprows;
 
           for (HighsInt k = 0; k != numproprows; ++k) {
             HighsInt i = propagateinds[k];
@@ -2740,13 +2860,17 @@ double HighsDomain::feastol() const { return mipsolver->mipdata_->feastol; }
 HighsDomain::ConflictSet::ConflictSet(HighsDomain& localdom_)
     : localdom(localdom_),
       globaldom(localdom.mipsolver->mipdata_->domain),
-      reasonSideFrontier(),
-      reconvergenceFrontier(),
+      frontierAllocatorState(),
+      reasonSideFrontier(FrontierAllocator(&frontierAllocatorState)),
+      reconvergenceFrontier(FrontierAllocator(&frontierAllocatorState)),
       resolveQueue(),
-      resolvedDomainChanges() {}
+      resolvedDomainChanges(),
+      resolveBudget(kConflictResolveBudget +
+                    kConflictResolveBudgetPerCol *
+                        localdom.mipsolver->mipdata_->integral_cols.size()) {}
 
 bool HighsDomain::ConflictSet::explainBoundChangeGeq(
-    const std::set<LocalDomChg>& currentFrontier, const LocalDomChg& domchg,
+    const Frontier& currentFrontier, const LocalDomChg& domchg,
     const HighsInt* inds, const double* vals, HighsInt len, double rhs,
     double maxAct) {
   if (maxAct == kHighsInf) return false;
@@ -2855,7 +2979,7 @@ bool HighsDomain::ConflictSet::explainBoundChangeGeq(
 }
 
 bool HighsDomain::ConflictSet::explainBoundChangeLeq(
-    const std::set<LocalDomChg>& currentFrontier, const LocalDomChg& domchg,
+    const Frontier& currentFrontier, const LocalDomChg& domchg,
     const HighsInt* inds, const double* vals, HighsInt len, double rhs,
     double minAct) {
   if (minAct == -kHighsInf) return false;
@@ -3449,7 +3573,7 @@ bool HighsDomain::ConflictSet::explainInfeasibilityLeq(const HighsInt* inds,
 }
 
 bool HighsDomain::ConflictSet::explainBoundChange(
-    const std::set<LocalDomChg>& currentFrontier, LocalDomChg domchg) {
+    const Frontier& currentFrontier, LocalDomChg domchg) {
   switch (localdom.domchgreason_[domchg.pos].type) {
     case Reason::kUnknown:
     case Reason::kBranching:
@@ -3640,23 +3764,22 @@ bool HighsDomain::ConflictSet::explainBoundChangeConflict(
   return foundDomchg;
 }
 
-void HighsDomain::ConflictSet::pushQueue(
-    std::set<LocalDomChg>::iterator domchg) {
+void HighsDomain::ConflictSet::pushQueue(Frontier::iterator domchg) {
   resolveQueue.emplace_back(domchg);
-  std::push_heap(
-      resolveQueue.begin(), resolveQueue.end(),
-      [](const std::set<LocalDomChg>::iterator& a,
-         const std::set<LocalDomChg>::iterator& b) { return a->pos < b->pos; });
+  std::push_heap(resolveQueue.begin(), resolveQueue.end(),
+                 [](const Frontier::iterator& a, const Frontier::iterator& b) {
+                   return a->pos < b->pos;
+                 });
 }
 
-std::set<HighsDomain::ConflictSet::LocalDomChg>::iterator
+HighsDomain::ConflictSet::Frontier::iterator
 HighsDomain::ConflictSet::popQueue() {
   assert(!resolveQueue.empty());
-  std::pop_heap(
-      resolveQueue.begin(), resolveQueue.end(),
-      [](const std::set<LocalDomChg>::iterator& a,
-         const std::set<LocalDomChg>::iterator& b) { return a->pos < b->pos; });
-  std::set<LocalDomChg>::iterator elem = resolveQueue.back();
+  std::pop_heap(resolveQueue.begin(), resolveQueue.end(),
+                [](const Frontier::iterator& a, const Frontier::iterator& b) {
+                  return a->pos < b->pos;
+                });
+  Frontier::iterator elem = resolveQueue.back();
   resolveQueue.pop_back();
   return elem;
 }
@@ -3679,7 +3802,7 @@ bool HighsDomain::ConflictSet::resolvable(HighsInt domChgPos) {
   }
 }
 
-HighsInt HighsDomain::ConflictSet::resolveDepth(std::set<LocalDomChg>& frontier,
+HighsInt HighsDomain::ConflictSet::resolveDepth(Frontier& frontier,
                                                 HighsInt depthLevel,
                                                 HighsInt stopSize,
                                                 HighsInt minResolve,
@@ -3713,9 +3836,11 @@ HighsInt HighsDomain::ConflictSet::resolveDepth(std::set<LocalDomChg>& frontier,
 
   HighsInt numResolved = 0;
 
-  while (queueSize() > stopSize ||
-         (queueSize() > 0 && numResolved < minResolve)) {
-    std::set<LocalDomChg>::iterator pos = popQueue();
+  while ((queueSize() > stopSize ||
+          (queueSize() > 0 && numResolved < minResolve)) &&
+         resolveBudget > 0) {
+    --resolveBudget;
+    Frontier::iterator pos = popQueue();
     if (!explainBoundChange(frontier, *pos)) continue;
 
     ++numResolved;
@@ -3842,6 +3967,10 @@ void HighsDomain::ConflictSet::conflictAnalysis(
         continue;
       }
     }
+    // stop when the resolution budget of this analysis is used up. This does
+    // not happen in the first non-empty depth level as nothing was resolved
+    // before
+    if (resolveBudget <= 0) break;
     HighsInt numNewConflicts = computeCuts(currDepth, conflictPool);
     // if the depth level was empty, do not consider it
     if (numNewConflicts == -1) {
@@ -3917,6 +4046,10 @@ void HighsDomain::ConflictSet::conflictAnalysis(
         continue;
       }
     }
+    // stop when the resolution budget of this analysis is used up. This does
+    // not happen in the first non-empty depth level as nothing was resolved
+    // before
+    if (resolveBudget <= 0) break;
     HighsInt numNewConflicts = computeCuts(currDepth, conflictPool);
     // if the depth level was empty, do not consider it
     if (numNewConflicts == -1) {
@@ -20,6 +20,7 @@
 #include "mip/HighsDomainChange.h"
 #include "mip/HighsMipSolver.h"
 #include "util/HighsCDouble.h"
+#include "util/HighsNodesetAllocator.h"
 #include "util/HighsRbTree.h"
 
 class HighsCutPool;
@@ -74,6 +75,12 @@ class HighsDomain {
       bool operator<(const LocalDomChg& other) const { return pos < other.pos; }
     };
 
+    // the frontiers take their nodes from chunks that are owned by the
+    // conflict set and released together when the analysis is finished
+    using FrontierAllocator = HighsNodesetAllocator<LocalDomChg>;
+    using Frontier =
+        std::set<LocalDomChg, std::less<LocalDomChg>, FrontierAllocator>;
+
     ConflictSet(HighsDomain& localdom);
 
     void conflictAnalysis(HighsConflictPool& conflictPool);
@@ -82,10 +89,13 @@ class HighsDomain {
                           HighsConflictPool& conflictPool);
 
    private:
-    std::set<LocalDomChg> reasonSideFrontier;
-    std::set<LocalDomChg> reconvergenceFrontier;
-    std::vector<std::set<LocalDomChg>::iterator> resolveQueue;
+    HighsNodesetAllocatorState frontierAllocatorState;
+    Frontier reasonSideFrontier;
+    Frontier reconvergenceFrontier;
+    std::vector<Frontier::iterator> resolveQueue;
     std::vector<LocalDomChg> resolvedDomainChanges;
+    // number of bound changes that may still be explained by their reasons
+    HighsInt resolveBudget;
 
     struct ResolveCandidate {
       double delta;
@@ -104,13 +114,13 @@ class HighsDomain {
 
     std::vector<ResolveCandidate> resolveBuffer;
 
-    void pushQueue(std::set<LocalDomChg>::iterator domchgPos);
-    std::set<LocalDomChg>::iterator popQueue();
+    void pushQueue(Frontier::iterator domchgPos);
+    Frontier::iterator popQueue();
     void clearQueue();
     HighsInt queueSize();
     bool resolvable(HighsInt domChgPos);
 
-    HighsInt resolveDepth(std::set<LocalDomChg>& frontier, HighsInt depthLevel,
+    HighsInt resolveDepth(Frontier& frontier, HighsInt depthLevel,
                           HighsInt stopSize, HighsInt minResolve = 0,
                           bool increaseConflictScore = false);
 
@@ -127,7 +137,7 @@ class HighsDomain {
     bool explainInfeasibilityGeq(const HighsInt* inds, const double* vals,
                                  HighsInt len, double rhs, double maxActivity);
 
-    bool explainBoundChange(const std::set<LocalDomChg>& currentFrontier,
+    bool explainBoundChange(const Frontier& currentFrontier,
                             LocalDomChg domchg);
 
     // bool explainBoundChange(HighsInt pos) {
@@ -139,12 +149,12 @@ class HighsDomain {
                                     const HighsDomainChange* conflict,
                                     HighsInt len);
 
-    bool explainBoundChangeLeq(const std::set<LocalDomChg>& currentFrontier,
+    bool explainBoundChangeLeq(const Frontier& currentFrontier,
                                const LocalDomChg& domChg, const HighsInt* inds,
                                const double* vals, HighsInt len, double rhs,
                                double minActivity);
 
-    bool explainBoundChangeGeq(const std::set<LocalDomChg>& currentFrontier,
+    bool explainBoundChangeGeq(const Frontier& currentFrontier,
                                const LocalDomChg& domChg, const HighsInt* inds,
                                const double* vals, HighsInt len, double rhs,
                                double maxActivity);
@@ -403,6 +413,12 @@ class HighsDomain {
                           const double* ARvalue, HighsInt& ninfmax,
                           HighsCDouble& activitymax);
 
+  // computes the minimal and maximal activity in a single pass over the row
+  void computeActivities(HighsInt start, HighsInt end, const HighsInt* ARindex,
+                         const double* ARvalue, HighsInt& ninfmin,
+                         HighsCDouble& activitymin, HighsInt& ninfmax,
+                         HighsCDouble& activitymax);
+
   double adjustedUb(HighsInt col, HighsCDouble boundVal, bool& accept) const;
 
   double adjustedLb(HighsInt col, HighsCDouble boundVal, bool& accept) const;
@@ -439,6 +455,12 @@ class HighsDomain {
         changedcols_.end());
   }
 
+  void markChangedCol(HighsInt col) {
+    if (changedcolsflags_[col]) return;
+    changedcolsflags_[col] = 1;
+    changedcols_.push_back(col);
+  }
+
   void clearChangedCols(HighsInt start) {
     HighsInt end = changedcols_.size();
     for (HighsInt i = start; i != end; ++i)
@@ -569,6 +591,19 @@ class HighsDomain {
   void setDomainChangeStack(const std::vector<HighsDomainChange>& domchgstack,
                             const std::vector<HighsInt>& branchingPositions);
 
+  // backtracks to the common ancestor of the current node and the node given
+  // by the domain change stack, i.e. to the longest common prefix of their
+  // branching decisions. Returns the number of kept branching decisions
+  HighsInt backtrackToCommonAncestor(
+      const std::vector<HighsDomainChange>& domchgstack,
+      const std::vector<HighsInt>& branchingPositions);
+
+  // applies the domain change stack of a node on top of the current domain,
+  // which must belong to an ancestor of the node. Bound changes that are
+  // already implied, such as common branching decisions, are skipped
+  void applyDomainChangeStack(const std::vector<HighsDomainChange>& domchgstack,
+                              const std::vector<HighsInt>& branchingPositions);
+
   bool propagate();
 
   double getColLowerPos(HighsInt col, HighsInt stackpos, HighsInt& pos) const;
@@ -115,6 +115,7 @@ HighsLpRelaxation::HighsLpRelaxation(const HighsMipSolver& mipsolver)
   avgSolveIters = 0;
   numSolved = 0;
   epochs = 0;
+  numRowChanges = 0;
   maxNumFractional = 0;
   lastAgeCall = 0;
   objective = -kHighsInf;
@@ -142,6 +143,7 @@ HighsLpRelaxation::HighsLpRelaxation(const HighsLpRelaxation& other)
   avgSolveIters = 0;
   numSolved = 0;
   epochs = 0;
+  numRowChanges = 0;
   maxNumFractional = 0;
   lastAgeCall = 0;
   objective = -kHighsInf;
@@ -161,6 +163,7 @@ void HighsLpRelaxation::loadModel() {
   lpsolver.clearSolver();
   lpsolver.clearModel();
   lpsolver.passModel(std::move(lpmodel));
+  ++numRowChanges;
   colLbBuffer.resize(lpmodel.num_col_);
   colUbBuffer.resize(lpmodel.num_col_);
 }
@@ -435,6 +438,7 @@ void HighsLpRelaxation::addCuts(HighsCutSet& cutset) {
                          cutset.ARvalue_.data()) == HighsStatus::kOk;
     assert(success);
     (void)success;
+    ++numRowChanges;
     assert(lpsolver.getLp().num_row_ ==
            (HighsInt)lpsolver.getLp().row_lower_.size());
     cutset.clear();
@@ -468,6 +472,7 @@ void HighsLpRelaxation::removeCuts(HighsInt ndelcuts,
     HighsBasis basis = lpsolver.getBasis();
     HighsInt nlprows = lpsolver.getNumRow();
     lpsolver.deleteRows(deletemask.data());
+    ++numRowChanges;
     for (HighsInt i = mipsolver.numRow(); i != nlprows; ++i) {
       if (deletemask[i] >= 0) {
         lprows[deletemask[i]] = lprows[i];
@@ -495,6 +500,7 @@ void HighsLpRelaxation::removeCuts() {
   HighsInt modelrows = mipsolver.numRow();
 
   lpsolver.deleteRows(modelrows, nlprows - 1);
+  ++numRowChanges;
   for (HighsInt i = modelrows; i != nlprows; ++i) {
     if (lprows[i].origin == LpRow::Origin::kCutPool)
       mipsolver.mipdata_->cutpool.lpCutRemoved(lprows[i].index);
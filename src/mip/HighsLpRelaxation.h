@@ -81,6 +81,7 @@ class HighsLpRelaxation {
   double avgSolveIters;
   int64_t numSolved;
   size_t epochs;
+  int64_t numRowChanges;
   HighsInt maxNumFractional;
   Status status;
   bool adjustSymBranchingCol;
@@ -224,6 +225,8 @@ class HighsLpRelaxation {
 
   int64_t getNumLpIterations() const { return numlpiters; }
 
+  int64_t getNumRowChanges() const { return numRowChanges; }
+
   bool integerFeasible() const {
     if ((status == Status::kOptimal ||
          status == Status::kUnscaledPrimalFeasible) &&
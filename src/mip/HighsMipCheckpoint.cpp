@@ -0,0 +1,325 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2024 by Julian Hall, Ivet Galabova,    */
+/*    Leona Gottwald and Michael Feldmeier                               */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+#include "mip/HighsMipCheckpoint.h"
+
+#include <cstring>
+#include <fstream>
+
+#include "mip/HighsMipSolverData.h"
+#include "util/HighsDataStack.h"
+#include "util/HighsHash.h"
+
+namespace {
+
+const char kCheckpointMagic[] = "HiGHS MIP checkpoint";
+const uint32_t kCheckpointVersion = 1;
+
+template <typename T>
+void combineHash(uint64_t& hash, const std::vector<T>& data) {
+  hash = (hash ^ HighsHashHelpers::vector_hash(data.data(), data.size())) *
+         HighsHashHelpers::fibonacci_muliplier();
+}
+
+}  // namespace
+
+uint64_t HighsMipCheckpoint::computeModelHash(const HighsLp& lp) {
+  uint64_t hash = 0;
+  combineHash(hash, std::vector<double>{lp.offset_, double(lp.sense_)});
+  combineHash(hash, lp.col_cost_);
+  combineHash(hash, lp.col_lower_);
+  combineHash(hash, lp.col_upper_);
+  combineHash(hash, lp.row_lower_);
+  combineHash(hash, lp.row_upper_);
+  combineHash(hash, lp.a_matrix_.start_);
+  combineHash(hash, lp.a_matrix_.index_);
+  combineHash(hash, lp.a_matrix_.value_);
+  combineHash(hash, lp.integrality_);
+  return hash;
+}
+
+bool HighsMipCheckpoint::matchesModel(const HighsLp& lp) const {
+  return num_col == lp.num_col_ && num_row == lp.num_row_ &&
+         num_nz == lp.a_matrix_.numNz() && model_hash == computeModelHash(lp);
+}
+
+void HighsMipCheckpoint::capture(const HighsMipSolver& mipsolver) {
+  const HighsMipSolverData& mipdata = *mipsolver.mipdata_;
+  const HighsLp& model = *mipsolver.orig_model_;
+
+  num_col = model.num_col_;
+  num_row = model.num_row_;
+  num_nz = model.a_matrix_.numNz();
+  model_hash = computeModelHash(model);
+
+  solution = mipsolver.solution_;
+  solution_objective = mipsolver.solution_objective_;
+  bound_violation = mipsolver.bound_violation_;
+  integrality_violation = mipsolver.integrality_violation_;
+  row_violation = mipsolver.row_violation_;
+  pscost = HighsPseudocostInitialization(
+      mipdata.pseudocost, mipsolver.options_mip_->mip_pscost_minreliable,
+      mipdata.postSolveStack);
+
+  presolved_num_row = mipsolver.numRow();
+  presolved_model_hash = computeModelHash(*mipsolver.model_);
+  presolved_orig_col.resize(mipsolver.numCol());
+  for (HighsInt i = 0; i != mipsolver.numCol(); ++i)
+    presolved_orig_col[i] = mipdata.postSolveStack.getOrigColIndex(i);
+
+  node_domchg.clear();
+  node_domchg_start.assign(1, 0);
+  node_branching.clear();
+  node_branching_start.assign(1, 0);
+  node_lower_bound.clear();
+  node_estimate.clear();
+  node_depth.clear();
+  mipdata.nodequeue.forEachActiveNode(
+      [&](const HighsNodeQueue::OpenNode& node) {
+        node_domchg.insert(node_domchg.end(), node.domchgstack.begin(),
+                           node.domchgstack.end());
+        node_domchg_start.push_back(node_domchg.size());
+        node_branching.insert(node_branching.end(), node.branchings.begin(),
+                              node.branchings.end());
+        node_branching_start.push_back(node_branching.size());
+        node_lower_bound.push_back(node.lower_bound);
+        node_estimate.push_back(node.estimate);
+        node_depth.push_back(node.depth);
+      });
+
+  cut_start.assign(1, 0);
+  cut_index.clear();
+  cut_value.clear();
+  cut_rhs.clear();
+  cut_integral.clear();
+  const HighsCutPool& cutpool = mipdata.cutpool;
+  HighsInt numRows = cutpool.getMatrix().getNumRows();
+  for (HighsInt i = 0; i != numRows; ++i) {
+    // deleted cuts have an empty range starting at -1
+    if (cutpool.getMatrix().getRowStart(i) == -1) continue;
+
+    HighsInt len;
+    const HighsInt* cutinds;
+    const double* cutvals;
+    cutpool.getCut(i, len, cutinds, cutvals);
+    cut_index.insert(cut_index.end(), cutinds, cutinds + len);
+    cut_value.insert(cut_value.end(), cutvals, cutvals + len);
+    cut_start.push_back(cut_index.size());
+    cut_rhs.push_back(cutpool.getRhs()[i]);
+    cut_integral.push_back(cutpool.cutIsIntegral(i));
+  }
+
+  num_nodes = mipdata.num_nodes;
+  num_leaves = mipdata.num_leaves;
+  pruned_treeweight = double(mipdata.pruned_treeweight);
+}
+
+bool HighsMipCheckpoint::restoreSearch(HighsMipSolver& mipsolver) const {
+  HighsMipSolverData& mipdata = *mipsolver.mipdata_;
+
+  // the nodes are only valid for the same presolved model since the parts of
+  // the tree that were pruned depend on its reductions
+  if (presolved_num_row != mipsolver.numRow() ||
+      (HighsInt)presolved_orig_col.size() != mipsolver.numCol() ||
+      presolved_model_hash != computeModelHash(*mipsolver.model_))
+    return false;
+  for (HighsInt i = 0; i != mipsolver.numCol(); ++i)
+    if (presolved_orig_col[i] != mipdata.postSolveStack.getOrigColIndex(i))
+      return false;
+
+  mipdata.nodequeue.clear();
+  mipdata.nodequeue.setOptimalityLimit(mipdata.optimality_limit);
+  mipdata.pruned_treeweight = pruned_treeweight;
+  for (HighsInt i = 0; i != numOpenNodes(); ++i) {
+    std::vector<HighsDomainChange> domchgs(
+        node_domchg.begin() + node_domchg_start[i],
+        node_domchg.begin() + node_domchg_start[i + 1]);
+    std::vector<HighsInt> branchings(
+        node_branching.begin() + node_branching_start[i],
+        node_branching.begin() + node_branching_start[i + 1]);
+    mipdata.pruned_treeweight += mipdata.nodequeue.emplaceNode(
+        std::move(domchgs), std::move(branchings), node_lower_bound[i],
+        node_estimate[i], node_depth[i]);
+  }
+
+  std::vector<HighsInt> inds;
+  std::vector<double> vals;
+  for (HighsInt i = 0; i != (HighsInt)cut_rhs.size(); ++i) {
+    inds.assign(cut_index.begin() + cut_start[i],
+                cut_index.begin() + cut_start[i + 1]);
+    vals.assign(cut_value.begin() + cut_start[i],
+                cut_value.begin() + cut_start[i + 1]);
+    mipdata.cutpool.addCut(mipsolver, inds.data(), vals.data(), inds.size(),
+                           cut_rhs[i], cut_integral[i] != 0);
+  }
+
+  // the counts of the checkpoint cover the search up to the checkpoint,
+  // including the root node that this run evaluated again, so they replace
+  // the counts of this run rather than being added to them
+  mipdata.num_nodes = num_nodes;
+  mipdata.num_leaves = num_leaves;
+  return true;
+}
+
+bool HighsMipCheckpoint::writeToFile(const std::string& filename) const {
+  HighsDataStack stack;
+  stack.push(num_col);
+  stack.push(num_row);
+  stack.push(num_nz);
+  stack.push(model_hash);
+
+  stack.push(solution);
+  stack.push(solution_objective);
+  stack.push(bound_violation);
+  stack.push(integrality_violation);
+  stack.push(row_violation);
+
+  stack.push(pscost.pseudocostup);
+  stack.push(pscost.pseudocostdown);
+  stack.push(pscost.nsamplesup);
+  stack.push(pscost.nsamplesdown);
+  stack.push(pscost.inferencesup);
+  stack.push(pscost.inferencesdown);
+  stack.push(pscost.ninferencesup);
+  stack.push(pscost.ninferencesdown);
+  stack.push(pscost.conflictscoreup);
+  stack.push(pscost.conflictscoredown);
+  stack.push(pscost.cost_total);
+  stack.push(pscost.inferences_total);
+  stack.push(pscost.conflict_avg_score);
+  stack.push(pscost.nsamplestotal);
+  stack.push(pscost.ninferencestotal);
+
+  stack.push(presolved_num_row);
+  stack.push(presolved_model_hash);
+  stack.push(presolved_orig_col);
+
+  stack.push(node_domchg);
+  stack.push(node_domchg_start);
+  stack.push(node_branching);
+  stack.push(node_branching_start);
+  stack.push(node_lower_bound);
+  stack.push(node_estimate);
+  stack.push(node_depth);
+
+  stack.push(cut_start);
+  stack.push(cut_index);
+  stack.push(cut_value);
+  stack.push(cut_rhs);
+  stack.push(cut_integral);
+
+  stack.push(num_nodes);
+  stack.push(num_leaves);
+  stack.push(pruned_treeweight);
+
+  const std::vector<char>& data = stack.getData();
+  uint32_t intSize = sizeof(HighsInt);
+  uint64_t dataSize = data.size();
+  uint64_t dataHash = HighsHashHelpers::vector_hash(data.data(), data.size());
+
+  std::ofstream out(filename, std::ios::binary);
+  if (!out) return false;
+  out.write(kCheckpointMagic, sizeof(kCheckpointMagic));
+  out.write(reinterpret_cast<const char*>(&kCheckpointVersion),
+            sizeof(kCheckpointVersion));
+  out.write(reinterpret_cast<const char*>(&intSize), sizeof(intSize));
+  out.write(reinterpret_cast<const char*>(&dataSize), sizeof(dataSize));
+  out.write(reinterpret_cast<const char*>(&dataHash), sizeof(dataHash));
+  out.write(data.data(), data.size());
+  return bool(out);
+}
+
+bool HighsMipCheckpoint::readFromFile(const std::string& filename) {
+  std::ifstream in(filename, std::ios::binary);
+  if (!in) return false;
+
+  char magic[sizeof(kCheckpointMagic)];
+  uint32_t version;
+  uint32_t intSize;
+  uint64_t dataSize;
+  uint64_t dataHash;
+  in.read(magic, sizeof(magic));
+  in.read(reinterpret_cast<char*>(&version), sizeof(version));
+  in.read(reinterpret_cast<char*>(&intSize), sizeof(intSize));
+  in.read(reinterpret_cast<char*>(&dataSize), sizeof(dataSize));
+  in.read(reinterpret_cast<char*>(&dataHash), sizeof(dataHash));
+  if (!in || std::memcmp(magic, kCheckpointMagic, sizeof(magic)) != 0 ||
+      version != kCheckpointVersion || intSize != sizeof(HighsInt))
+    return false;
+
+  // the data must fill the rest of the file, which is checked before its
+  // size is trusted for allocating memory
+  const std::streamoff dataStart = in.tellg();
+  in.seekg(0, std::ios::end);
+  const std::streamoff fileEnd = in.tellg();
+  if (!in || dataStart < 0 || uint64_t(fileEnd - dataStart) != dataSize)
+    return false;
+  in.seekg(dataStart);
+
+  std::vector<char> data(dataSize);
+  in.read(data.data(), dataSize);
+  if (!in ||
+      HighsHashHelpers::vector_hash(data.data(), data.size()) != dataHash)
+    return false;
+
+  // the data stack is read in the reverse order in which it was written
+  HighsDataStack stack;
+  stack.setData(std::move(data));
+  stack.pop(pruned_treeweight);
+  stack.pop(num_leaves);
+  stack.pop(num_nodes);
+
+  stack.pop(cut_integral);
+  stack.pop(cut_rhs);
+  stack.pop(cut_value);
+  stack.pop(cut_index);
+  stack.pop(cut_start);
+
+  stack.pop(node_depth);
+  stack.pop(node_estimate);
+  stack.pop(node_lower_bound);
+  stack.pop(node_branching_start);
+  stack.pop(node_branching);
+  stack.pop(node_domchg_start);
+  stack.pop(node_domchg);
+
+  stack.pop(presolved_orig_col);
+  stack.pop(presolved_model_hash);
+  stack.pop(presolved_num_row);
+
+  stack.pop(pscost.ninferencestotal);
+  stack.pop(pscost.nsamplestotal);
+  stack.pop(pscost.conflict_avg_score);
+  stack.pop(pscost.inferences_total);
+  stack.pop(pscost.cost_total);
+  stack.pop(pscost.conflictscoredown);
+  stack.pop(pscost.conflictscoreup);
+  stack.pop(pscost.ninferencesdown);
+  stack.pop(pscost.ninferencesup);
+  stack.pop(pscost.inferencesdown);
+  stack.pop(pscost.inferencesup);
+  stack.pop(pscost.nsamplesdown);
+  stack.pop(pscost.nsamplesup);
+  stack.pop(pscost.pseudocostdown);
+  stack.pop(pscost.pseudocostup);
+
+  stack.pop(row_violation);
+  stack.pop(integrality_violation);
+  stack.pop(bound_violation);
+  stack.pop(solution_objective);
+  stack.pop(solution);
+
+  stack.pop(model_hash);
+  stack.pop(num_nz);
+  stack.pop(num_row);
+  stack.pop(num_col);
+
+  return true;
+}
@@ -0,0 +1,95 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2024 by Julian Hall, Ivet Galabova,    */
+/*    Leona Gottwald and Michael Feldmeier                               */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**@file mip/HighsMipCheckpoint.h
+ * @brief State of an interrupted branch-and-bound search that can be written
+ * to a file and used to resume the search
+ */
+
+#ifndef HIGHS_MIP_CHECKPOINT_H_
+#define HIGHS_MIP_CHECKPOINT_H_
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "lp_data/HConst.h"
+#include "mip/HighsDomainChange.h"
+#include "mip/HighsPseudocost.h"
+#include "util/HighsInt.h"
+
+class HighsMipSolver;
+class HighsLp;
+
+struct HighsMipCheckpoint {
+  // fingerprint of the model given to the MIP solver
+  HighsInt num_col = 0;
+  HighsInt num_row = 0;
+  HighsInt num_nz = 0;
+  uint64_t model_hash = 0;
+
+  // incumbent and pseudocosts in the space of the model given to the MIP
+  // solver
+  std::vector<double> solution;
+  double solution_objective = kHighsInf;
+  double bound_violation = 0;
+  double integrality_violation = 0;
+  double row_violation = 0;
+  HighsPseudocostInitialization pscost;
+
+  // presolved model that the open nodes and the cuts refer to, identified by
+  // its fingerprint and the original index of each of its columns
+  HighsInt presolved_num_row = 0;
+  uint64_t presolved_model_hash = 0;
+  std::vector<HighsInt> presolved_orig_col;
+
+  // open nodes stored consecutively, node i uses the domain changes in
+  // [node_domchg_start[i], node_domchg_start[i + 1]) and likewise the
+  // branching positions
+  std::vector<HighsDomainChange> node_domchg;
+  std::vector<HighsInt> node_domchg_start;
+  std::vector<HighsInt> node_branching;
+  std::vector<HighsInt> node_branching_start;
+  std::vector<double> node_lower_bound;
+  std::vector<double> node_estimate;
+  std::vector<HighsInt> node_depth;
+
+  // cuts of the global cut pool in compressed row format
+  std::vector<HighsInt> cut_start;
+  std::vector<HighsInt> cut_index;
+  std::vector<double> cut_value;
+  std::vector<double> cut_rhs;
+  std::vector<uint8_t> cut_integral;
+
+  int64_t num_nodes = 0;
+  int64_t num_leaves = 0;
+  double pruned_treeweight = 0;
+
+  static uint64_t computeModelHash(const HighsLp& lp);
+
+  bool matchesModel(const HighsLp& lp) const;
+
+  HighsInt numOpenNodes() const { return node_lower_bound.size(); }
+
+  /// stores the state of the given MIP solver whose search stopped with open
+  /// nodes that are all held in its node queue
+  void capture(const HighsMipSolver& mipsolver);
+
+  /// replaces the open nodes of the given MIP solver after its root node
+  /// evaluation with the stored ones and adds the stored cuts. Returns false
+  /// if the presolved model differs from the one the nodes refer to
+  bool restoreSearch(HighsMipSolver& mipsolver) const;
+
+  bool writeToFile(const std::string& filename) const;
+
+  bool readFromFile(const std::string& filename);
+};
+
+#endif
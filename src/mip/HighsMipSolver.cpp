@@ -17,6 +17,7 @@
 #include "mip/HighsDomain.h"
 #include "mip/HighsImplications.h"
 #include "mip/HighsLpRelaxation.h"
+#include "mip/HighsMipCheckpoint.h"
 #include "mip/HighsMipSolverData.h"
 #include "mip/HighsPseudocost.h"
 #include "mip/HighsSearch.h"
@@ -41,7 +42,8 @@ HighsMipSolver::HighsMipSolver(HighsCallback& callback,
       rootbasis(nullptr),
       pscostinit(nullptr),
       clqtableinit(nullptr),
-      implicinit(nullptr) {
+      implicinit(nullptr),
+      checkpointinit(nullptr) {
   if (solution.value_valid) {
     // MIP solver doesn't check row residuals, but they should be OK
     // so validate using assert
@@ -113,6 +115,20 @@ void HighsMipSolver::run() {
         fopen(options_mip_->mip_improving_solution_file.c_str(), "w");
 
   mipdata_ = decltype(mipdata_)(new HighsMipSolverData(*this));
+  checkpoint_.reset();
+  if (checkpointinit) {
+    // take over the incumbent and the pseudocosts of the checkpoint
+    const double sense = double(orig_model_->sense_);
+    if (sense * checkpointinit->solution_objective <
+        sense * solution_objective_) {
+      solution_ = checkpointinit->solution;
+      solution_objective_ = checkpointinit->solution_objective;
+      bound_violation_ = checkpointinit->bound_violation;
+      integrality_violation_ = checkpointinit->integrality_violation;
+      row_violation_ = checkpointinit->row_violation;
+    }
+    pscostinit = &checkpointinit->pscost;
+  }
   mipdata_->init();
   mipdata_->runPresolve(options_mip_->presolve_reduction_limit);
   // Identify whether time limit has been reached (in presolve)
@@ -129,11 +145,14 @@ void HighsMipSolver::run() {
       mipdata_->upper_bound = 0;
       mipdata_->transformNewIntegerFeasibleSolution(std::vector<double>());
     }
+    pscostinit = nullptr;
+    checkpointinit = nullptr;
     cleanupSolve();
     return;
   }
 
   mipdata_->runSetup();
+  if (checkpointinit) pscostinit = nullptr;
 restart:
   if (modelstatus_ == HighsModelStatus::kNotset) {
     mipdata_->evaluateRootNode();
@@ -144,6 +163,19 @@ restart:
     mipdata_->cutpool.performAging();
     mipdata_->cutpool.performAging();
     mipdata_->cutpool.performAging();
+
+    if (checkpointinit && !mipdata_->nodequeue.empty()) {
+      if (checkpointinit->restoreSearch(*this))
+        highsLogUser(options_mip_->log_options, HighsLogType::kInfo,
+                     "Resuming the search from a checkpoint with %" HIGHSINT_FORMAT
+                     " open nodes\n",
+                     checkpointinit->numOpenNodes());
+      else
+        highsLogUser(options_mip_->log_options, HighsLogType::kWarning,
+                     "Presolved model differs from the one of the checkpoint, "
+                     "restarting the search from the root node\n");
+    }
+    checkpointinit = nullptr;
   }
   if (mipdata_->nodequeue.empty()) {
     cleanupSolve();
@@ -157,8 +189,11 @@ restart:
 
   search.setLpRelaxation(&mipdata_->lp);
   sepa.setLpRelaxation(&mipdata_->lp);
+  // switching between nodes only backtracks to their common ancestor
+  search.setIncrementalNodeSwitch(true);
 
   mipdata_->lower_bound = mipdata_->nodequeue.getBestLowerBound();
+  mipdata_->treeSizeEstimator.reset(timer_.read(timer_.solve_clock));
 
   mipdata_->printDisplayLine();
   search.installNode(mipdata_->nodequeue.popBestBoundNode());
@@ -200,12 +235,20 @@ restart:
             mipdata_->heuristics.randomizedRounding(
                 mipdata_->lp.getLpSolver().getSolution().col_value);
 
+          // with more than one thread the sub-MIP of RENS/RINS runs in the
+          // background while this plunge continues
+          mipdata_->heuristics.setSubMipsInBackground(
+              !submip && highs::parallel::num_threads() > 1);
           if (mipdata_->incumbent.empty())
             mipdata_->heuristics.RENS(
                 mipdata_->lp.getLpSolver().getSolution().col_value);
+          else if (!submip && options_mip_->mip_heuristic_run_alns)
+            mipdata_->heuristics.ALNS(
+                mipdata_->lp.getLpSolver().getSolution().col_value);
           else
             mipdata_->heuristics.RINS(
                 mipdata_->lp.getLpSolver().getSolution().col_value);
+          mipdata_->heuristics.setSubMipsInBackground(false);
 
           mipdata_->heuristics.flushStatistics();
         }
@@ -245,6 +288,7 @@ restart:
     }
     search.openNodesToQueue(mipdata_->nodequeue);
     search.flushStatistics();
+    mipdata_->heuristics.finishBackgroundSubMip();
 
     if (limit_reached) {
       mipdata_->lower_bound = std::min(mipdata_->upper_bound,
@@ -272,6 +316,7 @@ restart:
 
     mipdata_->lower_bound = std::min(mipdata_->upper_bound,
                                      mipdata_->nodequeue.getBestLowerBound());
+    mipdata_->updateTreeSizeEstimate();
     mipdata_->printDisplayLine();
     if (mipdata_->nodequeue.empty()) break;
 
@@ -293,13 +338,20 @@ restart:
 
     if (!submip && mipdata_->num_nodes >= nextCheck) {
       auto nTreeRestarts = mipdata_->numRestarts - mipdata_->numRestartsRoot;
+      // size of the tree of this run as forecast by the tree size estimator,
+      // or extrapolated from the tree weight pruned since the last check as
+      // long as the estimator has no forecast
+      double remainingNodes = mipdata_->treeSizeEstimator.getRemainingNodes();
       double currNodeEstim =
-          numNodesLastCheck - mipdata_->num_nodes_before_run +
-          (mipdata_->num_nodes - numNodesLastCheck) *
-              double(1.0 - mipdata_->pruned_treeweight) /
-              std::max(
-                  double(mipdata_->pruned_treeweight - treeweightLastCheck),
-                  mipdata_->epsilon);
+          remainingNodes != kHighsInf
+              ? double(mipdata_->num_nodes - mipdata_->num_nodes_before_run) +
+                    remainingNodes
+              : numNodesLastCheck - mipdata_->num_nodes_before_run +
+                    (mipdata_->num_nodes - numNodesLastCheck) *
+                        double(1.0 - mipdata_->pruned_treeweight) /
+                        std::max(double(mipdata_->pruned_treeweight -
+                                        treeweightLastCheck),
+                                 mipdata_->epsilon);
       // printf(
       //     "nTreeRestarts: %d, numNodesThisRun: %ld, numNodesLastCheck: %ld,
       //     " "currNodeEstim: %g, " "prunedTreeWeightDelta: %g,
@@ -313,10 +365,15 @@ restart:
       //     numHugeTreeEstim,
       //     mipdata_->num_leaves - mipdata_->num_leaves_before_run);
 
-      bool doRestart = false;
+      // restart when the global bound changes learned during the search, e.g.
+      // from conflicts or reduced cost fixing, made enough integer columns
+      // inactive for presolve to remove them
+      double fixingRate = mipdata_->percentageInactiveIntegers();
+      bool doRestart = options_mip_->mip_allow_restart &&
+                       options_mip_->presolve != kHighsOffString &&
+                       fixingRate >= 10.0;
 
-      double activeIntegerRatio =
-          1.0 - mipdata_->percentageInactiveIntegers() / 100.0;
+      double activeIntegerRatio = 1.0 - fixingRate / 100.0;
       activeIntegerRatio *= activeIntegerRatio;
 
       if (!doRestart) {
@@ -355,14 +412,16 @@ restart:
           doRestart = false;
         }
       } else {
-        // count restart due to many fixings within the first 1000 nodes as
-        // root restart
+        // count restart due to many fixings as root restart so that it does
+        // not raise the tree size needed for the next restart
         ++mipdata_->numRestartsRoot;
       }
 
       if (doRestart) {
         highsLogUser(options_mip_->log_options, HighsLogType::kInfo,
                      "\nRestarting search from the root node\n");
+        // the restart takes the column bounds of the LP, which must be global
+        search.resetLocalDomain();
         mipdata_->performRestart();
         goto restart;
       }
@@ -492,6 +551,34 @@ restart:
     if (limit_reached) break;
   }
 
+  if (mipdata_->nodequeue.getNumSpillWrites() != 0)
+    highsLogDev(options_mip_->log_options, HighsLogType::kInfo,
+                "Node queue wrote %" PRId64
+                " open nodes to its temporary file and read %" PRId64
+                " back\n",
+                mipdata_->nodequeue.getNumSpillWrites(),
+                mipdata_->nodequeue.getNumSpillReads());
+
+  if (mipdata_->heuristics.getNumAlnsCalls() != 0)
+    highsLogDev(options_mip_->log_options, HighsLogType::kInfo,
+                "ALNS solved %" HIGHSINT_FORMAT
+                " sub-MIPs, of which %" HIGHSINT_FORMAT
+                " improved the incumbent\n",
+                mipdata_->heuristics.getNumAlnsCalls(),
+                mipdata_->heuristics.getNumAlnsSuccesses());
+
+  if (!submip) {
+    // keep the open nodes of a search that stopped at a limit so that it can
+    // be resumed from a checkpoint, unless they cannot all be read back
+    if (search.hasNode()) search.openNodesToQueue(mipdata_->nodequeue);
+    if (!mipdata_->nodequeue.empty() &&
+        !mipdata_->nodequeue.hasSpillReadError()) {
+      checkpoint_ = std::make_shared<HighsMipCheckpoint>();
+      checkpoint_->capture(*this);
+      if (mipdata_->nodequeue.hasSpillReadError()) checkpoint_.reset();
+    }
+  }
+
   cleanupSolve();
 }
 
@@ -613,7 +700,8 @@ void HighsMipSolver::cleanupSolve() {
                "  LP iterations     %llu (total)\n"
                "                    %llu (strong br.)\n"
                "                    %llu (separation)\n"
-               "                    %llu (heuristics)\n",
+               "                    %llu (heuristics)\n"
+               "  Work units        %.0f\n",
                timer_.read(timer_.solve_clock),
                timer_.read(timer_.presolve_clock),
                timer_.read(timer_.postsolve_clock),
@@ -621,7 +709,8 @@ void HighsMipSolver::cleanupSolve() {
                (long long unsigned)mipdata_->total_lp_iterations,
                (long long unsigned)mipdata_->sb_lp_iterations,
                (long long unsigned)mipdata_->sepa_lp_iterations,
-               (long long unsigned)mipdata_->heuristic_lp_iterations);
+               (long long unsigned)mipdata_->heuristic_lp_iterations,
+               mipdata_->workUnits());
 
   assert(modelstatus_ != HighsModelStatus::kNotset);
 }
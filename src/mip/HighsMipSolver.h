@@ -20,6 +20,7 @@ class HighsCutPool;
 struct HighsPseudocostInitialization;
 class HighsCliqueTable;
 class HighsImplications;
+struct HighsMipCheckpoint;
 
 class HighsMipSolver {
  public:
@@ -49,6 +50,10 @@ class HighsMipSolver {
   const HighsPseudocostInitialization* pscostinit;
   const HighsCliqueTable* clqtableinit;
   const HighsImplications* implicinit;
+  // checkpoint to resume the search from and checkpoint of the search when it
+  // stops with open nodes
+  const HighsMipCheckpoint* checkpointinit;
+  std::shared_ptr<HighsMipCheckpoint> checkpoint_;
 
   std::unique_ptr<HighsMipSolverData> mipdata_;
 
@@ -212,6 +212,151 @@ void HighsMipSolverData::finishSymmetryDetection(
     globalOrbits = symmetries.computeStabilizerOrbits(domain);
 }
 
+void HighsMipSolverData::startRootRacing(
+    const highs::parallel::TaskGroup& taskGroup,
+    std::unique_ptr<RootRacingData>& racingData) {
+  racingData.reset();
+  // with a single thread the racers could only run after the root node of the
+  // solver, so they are not used
+  const HighsInt numRacers = mipsolver.options_mip_->mip_root_racers;
+  if (numRacers == 0 || mipsolver.submip ||
+      highs::parallel::num_threads() == 1)
+    return;
+
+  racingData = std::unique_ptr<RootRacingData>(new RootRacingData());
+  RootRacingData* data = racingData.get();
+  data->model = *mipsolver.model_;
+  data->racers.resize(numRacers);
+
+  const double timeLimit = mipsolver.options_mip_->time_limit -
+                           mipsolver.timer_.read(mipsolver.timer_.solve_clock);
+  for (HighsInt i = 0; i != numRacers; ++i) {
+    RootRacingData::Racer& racer = data->racers[i];
+    // the racers solve the model of this root node as it is, so that their
+    // solutions and cuts can be used without transformation
+    racer.options = *mipsolver.options_mip_;
+    racer.options.output_flag = false;
+    racer.options.presolve = kHighsOffString;
+    racer.options.mip_allow_restart = false;
+    racer.options.mip_detect_symmetry = false;
+    racer.options.mip_root_racers = 0;
+    racer.options.mip_improving_solution_save = false;
+    racer.options.mip_improving_solution_file = "";
+    racer.options.time_limit = timeLimit;
+    racer.options.random_seed =
+        (mipsolver.options_mip_->random_seed + i + 1) % kHighsIInf;
+    if (i % 2 == 1)
+      racer.options.mip_heuristic_effort =
+          std::min(1.0, 2 * mipsolver.options_mip_->mip_heuristic_effort);
+
+    racer.callback.clear();
+    racer.callback.user_callback =
+        [data](int, const std::string&, const HighsCallbackDataOut*,
+               HighsCallbackDataIn* data_in, void*) {
+          data_in->user_interrupt = data->stop.load(std::memory_order_relaxed);
+        };
+    racer.callback.active[kCallbackMipInterrupt] = true;
+  }
+
+  for (RootRacingData::Racer& racer : data->racers) {
+    RootRacingData::Racer* racerPtr = &racer;
+    taskGroup.spawn([data, racerPtr]() {
+      RootRacingData::Racer& racer = *racerPtr;
+      // a racer that did not start before the root node evaluation of the
+      // solver was left early is not run at all
+      if (data->stop.load(std::memory_order_relaxed)) return;
+      HighsSolution solution;
+      HighsMipSolver racingSolver(racer.callback, racer.options, data->model,
+                                  solution);
+      racingSolver.timer_.start(racingSolver.timer_.solve_clock);
+      racingSolver.improving_solution_file_ = nullptr;
+      racingSolver.mipdata_ = decltype(racingSolver.mipdata_)(
+          new HighsMipSolverData(racingSolver));
+      HighsMipSolverData& racerData = *racingSolver.mipdata_;
+      racerData.init();
+      racerData.runPresolve(racer.options.presolve_reduction_limit);
+      if (racingSolver.modelstatus_ != HighsModelStatus::kNotset ||
+          racerData.postSolveStack.numReductions() != 0)
+        return;
+
+      racerData.runSetup();
+      if (racingSolver.modelstatus_ == HighsModelStatus::kNotset)
+        racerData.evaluateRootNode();
+
+      if (racingSolver.solution_objective_ != kHighsInf)
+        racer.solution = racingSolver.solution_;
+
+      // a racer that solved the model passes on its solution only, whereas
+      // any other racer passes on the bound of its last root LP and the cuts
+      // in it
+      if (racingSolver.modelstatus_ == HighsModelStatus::kOptimal ||
+          racingSolver.modelstatus_ == HighsModelStatus::kInfeasible)
+        return;
+
+      racer.lower_bound = racerData.lower_bound;
+      const HighsLpRelaxation& lp = racerData.lp;
+      racer.cutStart.push_back(0);
+      for (HighsInt row = racingSolver.numRow(); row < lp.numRows(); ++row) {
+        HighsInt len;
+        const HighsInt* inds;
+        const double* vals;
+        lp.getRow(row, len, inds, vals);
+        racer.cutIndex.insert(racer.cutIndex.end(), inds, inds + len);
+        racer.cutValue.insert(racer.cutValue.end(), vals, vals + len);
+        racer.cutStart.push_back(racer.cutIndex.size());
+        racer.cutUpper.push_back(lp.getLp().row_upper_[row]);
+        racer.cutIntegral.push_back(lp.isRowIntegral(row));
+      }
+    });
+  }
+}
+
+HighsInt HighsMipSolverData::finishRootRacing(
+    const highs::parallel::TaskGroup& taskGroup,
+    std::unique_ptr<RootRacingData>& racingData) {
+  // the root node of the solver finished its cut loop, and the racers are
+  // waited for rather than stopped, so that what they pass on is always the
+  // result of their complete root node evaluation and does not depend on the
+  // timing
+  for (size_t i = 0; i != racingData->racers.size(); ++i) taskGroup.sync();
+
+  // merge in the order of the racers so that ties are broken independently of
+  // which racer finished first
+  HighsInt best = -1;
+  for (HighsInt i = 0; i != (HighsInt)racingData->racers.size(); ++i) {
+    const RootRacingData::Racer& racer = racingData->racers[i];
+    if (!racer.solution.empty()) trySolution(racer.solution, 'O');
+    if (racer.lower_bound > lower_bound &&
+        (best == -1 ||
+         racer.lower_bound > racingData->racers[best].lower_bound))
+      best = i;
+  }
+
+  HighsInt numCuts = 0;
+  if (best != -1) {
+    RootRacingData::Racer& racer = racingData->racers[best];
+    highsLogDev(mipsolver.options_mip_->log_options, HighsLogType::kInfo,
+                "Root racer %" HIGHSINT_FORMAT
+                " improved the dual bound from %g to %g with %" HIGHSINT_FORMAT
+                " cuts\n",
+                best, lower_bound + mipsolver.model_->offset_,
+                racer.lower_bound + mipsolver.model_->offset_,
+                (HighsInt)racer.cutUpper.size());
+    lower_bound = racer.lower_bound;
+    for (HighsInt i = 0; i != (HighsInt)racer.cutUpper.size(); ++i) {
+      HighsInt start = racer.cutStart[i];
+      HighsInt len = racer.cutStart[i + 1] - start;
+      if (cutpool.addCut(mipsolver, racer.cutIndex.data() + start,
+                         racer.cutValue.data() + start, len, racer.cutUpper[i],
+                         racer.cutIntegral[i]) != -1)
+        ++numCuts;
+    }
+  }
+
+  racingData.reset();
+  return numCuts;
+}
+
 double HighsMipSolverData::computeNewUpperLimit(double ub, double mip_abs_gap,
                                                 double mip_rel_gap) const {
   double new_upper_limit;
@@ -374,6 +519,8 @@ void HighsMipSolverData::init() {
   heuristic_lp_iterations_before_run = 0;
   sepa_lp_iterations_before_run = 0;
   sb_lp_iterations_before_run = 0;
+  num_propagated_rows = 0;
+  num_separated_cuts = 0;
   num_disp_lines = 0;
   numCliqueEntriesAfterPresolve = 0;
   numCliqueEntriesAfterFirstPresolve = 0;
@@ -472,6 +619,8 @@ void HighsMipSolverData::runSetup() {
   pseudocost = HighsPseudocost(mipsolver);
   nodequeue.setNumCol(mipsolver.numCol());
   nodequeue.setOptimalityLimit(optimality_limit);
+  nodequeue.setNodeMemoryLimit(mipsolver.options_mip_->mip_node_memory_limit *
+                               1024.0 * 1024.0);
 
   continuous_cols.clear();
   integer_cols.clear();
@@ -920,6 +1069,88 @@ double HighsMipSolverData::percentageInactiveIntegers() const {
                             numintegercols);
 }
 
+HighsInt HighsMipSolverData::appendConflictRowsToModel(HighsLp& model) const {
+  // a conflict on binary columns states that its bound changes cannot all hold
+  // together. With x_j = 1 for the changed lower bounds in L and x_j = 0 for
+  // the changed upper bounds in U this is the row
+  //   sum_{j in L} x_j - sum_{j in U} x_j <= |L| - 1,
+  // which is appended like a cut so that presolve maps it to the new model
+  const std::vector<std::pair<HighsInt, HighsInt>>& conflictRanges =
+      conflictPool.getConflictRanges();
+  const std::vector<HighsDomainChange>& conflictEntries =
+      conflictPool.getConflictEntryVector();
+
+  std::vector<uint8_t> colMarked(mipsolver.numCol());
+  auto isBinaryConflict = [&](HighsInt start, HighsInt end) {
+    bool binary = true;
+    HighsInt i;
+    for (i = start; i != end; ++i) {
+      HighsInt col = conflictEntries[i].column;
+      if (colMarked[col] ||
+          mipsolver.variableType(col) == HighsVarType::kContinuous ||
+          domain.col_lower_[col] != 0.0 || domain.col_upper_[col] != 1.0 ||
+          conflictEntries[i].boundval !=
+              (conflictEntries[i].boundtype == HighsBoundType::kLower ? 1.0
+                                                                      : 0.0)) {
+        binary = false;
+        break;
+      }
+      colMarked[col] = true;
+    }
+    for (HighsInt j = start; j != i; ++j)
+      colMarked[conflictEntries[j].column] = false;
+    return binary;
+  };
+
+  // keep the shortest conflicts, at most as many as the model has rows
+  std::vector<std::pair<HighsInt, HighsInt>> conflicts;
+  HighsInt numConflicts = conflictRanges.size();
+  for (HighsInt i = 0; i != numConflicts; ++i) {
+    HighsInt start = conflictRanges[i].first;
+    HighsInt end = conflictRanges[i].second;
+    if (start == -1 || start == end) continue;
+    if (isBinaryConflict(start, end)) conflicts.emplace_back(end - start, i);
+  }
+
+  if (conflicts.empty()) return 0;
+
+  std::sort(conflicts.begin(), conflicts.end());
+  if ((HighsInt)conflicts.size() > mipsolver.numRow())
+    conflicts.resize(mipsolver.numRow());
+
+  HighsSparseMatrix conflictRows;
+  conflictRows.format_ = MatrixFormat::kRowwise;
+  conflictRows.num_col_ = model.num_col_;
+  conflictRows.num_row_ = 0;
+  conflictRows.start_.assign(1, 0);
+  for (const std::pair<HighsInt, HighsInt>& conflict : conflicts) {
+    HighsInt start = conflictRanges[conflict.second].first;
+    HighsInt end = conflictRanges[conflict.second].second;
+
+    double rhs = -1.0;
+    for (HighsInt i = start; i != end; ++i) {
+      const HighsDomainChange& domchg = conflictEntries[i];
+      conflictRows.index_.push_back(domchg.column);
+      if (domchg.boundtype == HighsBoundType::kLower) {
+        conflictRows.value_.push_back(1.0);
+        rhs += 1.0;
+      } else
+        conflictRows.value_.push_back(-1.0);
+    }
+    conflictRows.start_.push_back(conflictRows.index_.size());
+    ++conflictRows.num_row_;
+
+    model.row_lower_.push_back(-kHighsInf);
+    model.row_upper_.push_back(rhs);
+  }
+
+  model.a_matrix_.addRows(conflictRows);
+  model.num_row_ += conflictRows.num_row_;
+  if (!model.row_names_.empty()) model.row_names_.resize(model.num_row_);
+
+  return conflictRows.num_row_;
+}
+
 void HighsMipSolverData::performRestart() {
   HighsBasis root_basis;
   HighsPseudocostInitialization pscostinit(
@@ -935,15 +1166,24 @@ void HighsMipSolverData::performRestart() {
   heuristic_lp_iterations_before_run = heuristic_lp_iterations;
   sepa_lp_iterations_before_run = sepa_lp_iterations;
   sb_lp_iterations_before_run = sb_lp_iterations;
+  treeSizeEstimator.reset(mipsolver.timer_.read(mipsolver.timer_.solve_clock));
   HighsInt numLpRows = lp.getLp().num_row_;
   HighsInt numModelRows = mipsolver.numRow();
   HighsInt numCuts = numLpRows - numModelRows;
-  if (numCuts > 0) postSolveStack.appendCutsToModel(numCuts);
   auto integrality = std::move(presolvedModel.integrality_);
   double offset = presolvedModel.offset_;
   presolvedModel = lp.getLp();
   presolvedModel.offset_ = offset;
   presolvedModel.integrality_ = std::move(integrality);
+  // the conflicts are carried over together with the cuts of the LP
+  HighsInt numConflictRows = appendConflictRowsToModel(presolvedModel);
+  if (numConflictRows > 0)
+    highsLogDev(mipsolver.options_mip_->log_options, HighsLogType::kInfo,
+                "carrying %" HIGHSINT_FORMAT
+                " conflicts over to the restarted search\n",
+                numConflictRows);
+  numCuts += numConflictRows;
+  if (numCuts > 0) postSolveStack.appendCutsToModel(numCuts);
 
   const HighsBasis& basis = firstrootbasis;
   if (basis.valid) {
@@ -1094,6 +1334,7 @@ bool HighsMipSolverData::addIncumbent(const std::vector<double>& sol,
     if (solobj >= upper_bound) return false;
     upper_bound = solobj;
     incumbent = sol;
+    heuristics.addPoolSolution(sol);
     double new_upper_limit = computeNewUpperLimit(solobj, 0.0, 0.0);
 
     if (!mipsolver.submip) saveReportMipSolution(new_upper_limit);
@@ -1209,8 +1450,8 @@ void HighsMipSolverData::printDisplayLine(char first) {
     highsLogUser(
         mipsolver.options_mip_->log_options, HighsLogType::kInfo,
         // clang-format off
-        "\n        Nodes      |    B&B Tree     |            Objective Bounds              |  Dynamic Constraints |       Work      \n"
-          "     Proc. InQueue |  Leaves   Expl. | BestBound       BestSol              Gap |   Cuts   InLp Confl. | LpIters     Time\n\n"
+        "\n        Nodes      |    B&B Tree     |            Objective Bounds              |  Dynamic Constraints |           Work           \n"
+          "     Proc. InQueue |  Leaves   Expl. | BestBound       BestSol              Gap |   Cuts   InLp Confl. | LpIters     Time   Remain\n\n"
         // clang-format on
     );
 
@@ -1238,6 +1479,17 @@ void HighsMipSolverData::printDisplayLine(char first) {
 
   std::array<char, 22> print_lp_iters =
       convertToPrintString(total_lp_iterations);
+
+  // estimate of the remaining time of the tree search
+  std::array<char, 22> remain_string;
+  double remaining_time = treeSizeEstimator.getRemainingTime();
+  if (remaining_time == kHighsInf)
+    std::strcpy(remain_string.data(), "-");
+  else if (remaining_time >= 1e6)
+    std::strcpy(remain_string.data(), "Large");
+  else
+    std::snprintf(remain_string.data(), remain_string.size(), "%.1fs",
+                  remaining_time);
   if (upper_bound != kHighsInf) {
     ub = upper_bound + offset;
 
@@ -1268,12 +1520,13 @@ void HighsMipSolverData::printDisplayLine(char first) {
     highsLogUser(
         mipsolver.options_mip_->log_options, HighsLogType::kInfo,
         // clang-format off
-                 " %c %7s %7s   %7s %6.2f%%   %-15s %-15s %8s   %6" HIGHSINT_FORMAT " %6" HIGHSINT_FORMAT " %6" HIGHSINT_FORMAT "   %7s %7.1fs\n",
+                 " %c %7s %7s   %7s %6.2f%%   %-15s %-15s %8s   %6" HIGHSINT_FORMAT " %6" HIGHSINT_FORMAT " %6" HIGHSINT_FORMAT "   %7s %7.1fs %8s\n",
         // clang-format on
         first, print_nodes.data(), queue_nodes.data(), print_leaves.data(),
         explored, lb_string.data(), ub_string.data(), gap_string.data(),
         cutpool.getNumCuts(), lp.numRows() - lp.getNumModelRows(),
-        conflictPool.getNumConflicts(), print_lp_iters.data(), time);
+        conflictPool.getNumConflicts(), print_lp_iters.data(), time,
+        remain_string.data());
   } else {
     std::array<char, 22> ub_string;
     if (mipsolver.options_mip_->objective_bound < ub) {
@@ -1289,12 +1542,12 @@ void HighsMipSolverData::printDisplayLine(char first) {
     highsLogUser(
         mipsolver.options_mip_->log_options, HighsLogType::kInfo,
         // clang-format off
-        " %c %7s %7s   %7s %6.2f%%   %-15s %-15s %8.2f   %6" HIGHSINT_FORMAT " %6" HIGHSINT_FORMAT " %6" HIGHSINT_FORMAT "   %7s %7.1fs\n",
+        " %c %7s %7s   %7s %6.2f%%   %-15s %-15s %8.2f   %6" HIGHSINT_FORMAT " %6" HIGHSINT_FORMAT " %6" HIGHSINT_FORMAT "   %7s %7.1fs %8s\n",
         // clang-format on
         first, print_nodes.data(), queue_nodes.data(), print_leaves.data(),
         explored, lb_string.data(), ub_string.data(), gap, cutpool.getNumCuts(),
         lp.numRows() - lp.getNumModelRows(), conflictPool.getNumConflicts(),
-        print_lp_iters.data(), time);
+        print_lp_iters.data(), time, remain_string.data());
   }
   // Check that limitsToBounds yields the same values for the
   // dual_bound, primal_bound (modulo optimization sense) and
@@ -1432,8 +1685,19 @@ void HighsMipSolverData::evaluateRootNode() {
     maxSepaRounds =
         std::min(HighsInt(2 * std::sqrt(maxTreeSizeLog2)), maxSepaRounds);
   std::unique_ptr<SymmetryDetectionData> symData;
+  std::unique_ptr<RootRacingData> racingData;
   highs::parallel::TaskGroup tg;
+  // when the root node evaluation is left early, the racing root node
+  // evaluations are told to stop before the task group waits for them
+  struct StopRootRacing {
+    std::unique_ptr<RootRacingData>& racingData;
+    ~StopRootRacing() {
+      if (racingData) racingData->stop = true;
+    }
+  } stopRootRacing{racingData};
 restart:
+  // the racers are spawned first, as they are synced last
+  startRootRacing(tg, racingData);
   if (detectSymmetries) startSymmetryDetection(tg, symData);
   if (!analyticCenterComputed) startAnalyticCenterComputation(tg);
 
@@ -1522,6 +1786,7 @@ restart:
     double fixingRate = percentageInactiveIntegers();
     if (fixingRate >= 10.0) {
       tg.cancel();
+      if (racingData) racingData->stop = true;
       highsLogUser(mipsolver.options_mip_->log_options, HighsLogType::kInfo,
                    "\n%.1f%% inactive integer columns, restarting\n",
                    fixingRate);
@@ -1748,6 +2013,7 @@ restart:
       if (fixingRate >= 2.5 + 7.5 * mipsolver.submip ||
           (!mipsolver.submip && fixingRate > 0 && numRestarts == 0)) {
         tg.cancel();
+        if (racingData) racingData->stop = true;
         highsLogUser(mipsolver.options_mip_->log_options, HighsLogType::kInfo,
                      "\n%.1f%% inactive integer columns, restarting\n",
                      fixingRate);
@@ -1767,6 +2033,29 @@ restart:
       if (status == HighsLpRelaxation::Status::kInfeasible) return;
     }
 
+    if (racingData) {
+      HighsInt numRacingCuts = finishRootRacing(tg, racingData);
+      if (lower_bound > upper_limit) {
+        mipsolver.modelstatus_ = HighsModelStatus::kOptimal;
+        pruned_treeweight = 1.0;
+        num_nodes += 1;
+        num_leaves += 1;
+        return;
+      }
+
+      // separate the cuts of the strongest racing root node
+      if (numRacingCuts != 0) {
+        status = evaluateRootLp();
+        if (status == HighsLpRelaxation::Status::kInfeasible) return;
+        if (lp.scaledOptimal(status)) {
+          HighsInt ncuts;
+          if (rootSeparationRound(sepa, ncuts, status)) return;
+          ++nseparounds;
+        }
+        printDisplayLine();
+      }
+    }
+
     // add the root node to the nodequeue to initialize the search
     nodequeue.emplaceNode(std::vector<HighsDomainChange>(),
                           std::vector<HighsInt>(), lower_bound,
@@ -1774,6 +2063,42 @@ restart:
   }
 }
 
+double HighsMipSolverData::workUnits() const {
+  // Deterministic measure of the effort spent so far that does not depend on
+  // the machine load or the number of threads. Propagating a single row is
+  // orders of magnitude cheaper than an LP iteration, so it is scaled down
+  // accordingly.
+  return double(total_lp_iterations + num_nodes + num_separated_cuts) +
+         1e-2 * double(num_propagated_rows);
+}
+
+void HighsMipSolverData::updateTreeSizeEstimate() {
+  // relative gap between the bounds that is one without an incumbent or when
+  // the bounds have different signs
+  double gap = 1.0;
+  if (upper_bound != kHighsInf) {
+    double offset = mipsolver.model_->offset_;
+    double ub = upper_bound + offset;
+    double lb = std::min(lower_bound + offset, ub);
+    double scale = std::max(std::abs(ub), std::abs(lb));
+    if (scale <= epsilon)
+      gap = 0.0;
+    else if (ub * lb >= 0.0)
+      gap = (ub - lb) / scale;
+  }
+
+  treeSizeEstimator.update(num_nodes - num_nodes_before_run,
+                           num_leaves - num_leaves_before_run,
+                           double(pruned_treeweight), gap,
+                           nodequeue.getSubtreeGapSum(upper_limit),
+                           mipsolver.timer_.read(mipsolver.timer_.solve_clock));
+}
+
+double HighsMipSolverData::getEstimatedNodes() const {
+  // nodes of the whole solve, including those of earlier runs
+  return double(num_nodes) + treeSizeEstimator.getRemainingNodes();
+}
+
 bool HighsMipSolverData::checkLimits(int64_t nodeOffset) const {
   const HighsOptions& options = *mipsolver.options_mip_;
 
@@ -1791,6 +2116,17 @@ bool HighsMipSolverData::checkLimits(int64_t nodeOffset) const {
       return true;
     }
   }
+  // An open node that cannot be read back from the temporary file of the
+  // node queue stops the solve
+  if (nodequeue.hasSpillReadError()) {
+    if (mipsolver.modelstatus_ == HighsModelStatus::kNotset) {
+      highsLogUser(options.log_options, HighsLogType::kError,
+                   "Cannot read open nodes back from the temporary file of "
+                   "the node queue\n");
+      mipsolver.modelstatus_ = HighsModelStatus::kSolveError;
+    }
+    return true;
+  }
   // Possible termination due to objective being at least as good as
   // the target value
   if (!mipsolver.submip && mipsolver.solution_objective_ < kHighsInf &&
@@ -1852,6 +2188,29 @@ bool HighsMipSolverData::checkLimits(int64_t nodeOffset) const {
     return true;
   }
 
+  if (options.mip_max_work_units != kHighsInf &&
+      workUnits() >= options.mip_max_work_units) {
+    if (mipsolver.modelstatus_ == HighsModelStatus::kNotset) {
+      highsLogDev(options.log_options, HighsLogType::kInfo,
+                  "Reached work unit limit\n");
+      // Work units count LP iterations, together with nodes, cuts and
+      // propagated rows, so the limit on them is an iteration limit
+      mipsolver.modelstatus_ = HighsModelStatus::kIterationLimit;
+    }
+    return true;
+  }
+
+  if (!mipsolver.submip && options.mip_max_estimated_time != kHighsInf &&
+      treeSizeEstimator.getRemainingTime() != kHighsInf &&
+      treeSizeEstimator.getRemainingTime() >= options.mip_max_estimated_time) {
+    if (mipsolver.modelstatus_ == HighsModelStatus::kNotset) {
+      highsLogDev(options.log_options, HighsLogType::kInfo,
+                  "Reached estimated remaining time limit\n");
+      mipsolver.modelstatus_ = HighsModelStatus::kSolutionLimit;
+    }
+    return true;
+  }
+
   if (mipsolver.timer_.read(mipsolver.timer_.solve_clock) >=
       options.time_limit) {
     if (mipsolver.modelstatus_ == HighsModelStatus::kNotset) {
@@ -1997,5 +2356,8 @@ bool HighsMipSolverData::interruptFromCallbackWithData(
   // whereas mip_rel_gap in logging output (mimicked by
   // limitsToBounds) gives a percentage, so convert it a fraction
   mipsolver.callback_->data_out.mip_gap = 1e-2 * mip_rel_gap;
+  mipsolver.callback_->data_out.mip_estimated_nodes = getEstimatedNodes();
+  mipsolver.callback_->data_out.mip_estimated_remaining_time =
+      treeSizeEstimator.getRemainingTime();
   return mipsolver.callback_->callbackAction(callback_type, message);
 }
@@ -12,6 +12,7 @@
 #ifndef HIGHS_MIP_SOLVER_DATA_H_
 #define HIGHS_MIP_SOLVER_DATA_H_
 
+#include <atomic>
 #include <vector>
 
 #include "mip/HighsCliqueTable.h"
@@ -28,6 +29,7 @@
 #include "mip/HighsRedcostFixing.h"
 #include "mip/HighsSearch.h"
 #include "mip/HighsSeparation.h"
+#include "mip/HighsTreeSizeEstimator.h"
 #include "parallel/HighsParallel.h"
 #include "presolve/HighsPostsolveStack.h"
 #include "presolve/HighsSymmetry.h"
@@ -102,6 +104,8 @@ struct HighsMipSolverData {
   int64_t heuristic_lp_iterations_before_run;
   int64_t sepa_lp_iterations_before_run;
   int64_t sb_lp_iterations_before_run;
+  int64_t num_propagated_rows;
+  int64_t num_separated_cuts;
   int64_t num_disp_lines;
 
   HighsInt numImprovingSols;
@@ -112,6 +116,7 @@ struct HighsMipSolverData {
   std::vector<double> incumbent;
 
   HighsNodeQueue nodequeue;
+  HighsTreeSizeEstimator treeSizeEstimator;
 
   HighsDebugSol debugSolution;
 
@@ -149,6 +154,28 @@ struct HighsMipSolverData {
   void finishSymmetryDetection(const highs::parallel::TaskGroup& taskGroup,
                                std::unique_ptr<SymmetryDetectionData>& symData);
 
+  struct RootRacingData {
+    struct Racer {
+      HighsOptions options;
+      HighsCallback callback;
+      std::vector<double> solution;
+      double lower_bound = -kHighsInf;
+      std::vector<HighsInt> cutStart;
+      std::vector<HighsInt> cutIndex;
+      std::vector<double> cutValue;
+      std::vector<double> cutUpper;
+      std::vector<uint8_t> cutIntegral;
+    };
+    HighsLp model;
+    std::vector<Racer> racers;
+    std::atomic<bool> stop{false};
+  };
+
+  void startRootRacing(const highs::parallel::TaskGroup& taskGroup,
+                       std::unique_ptr<RootRacingData>& racingData);
+  HighsInt finishRootRacing(const highs::parallel::TaskGroup& taskGroup,
+                            std::unique_ptr<RootRacingData>& racingData);
+
   double computeNewUpperLimit(double upper_bound, double mip_abs_gap,
                               double mip_rel_gap) const;
   bool moreHeuristicsAllowed() const;
@@ -164,6 +191,7 @@ struct HighsMipSolverData {
       const std::vector<double>& sol,
       const bool possibly_store_as_new_incumbent = true);
   double percentageInactiveIntegers() const;
+  HighsInt appendConflictRowsToModel(HighsLp& model) const;
   void performRestart();
   bool checkSolution(const std::vector<double>& solution) const;
   bool trySolution(const std::vector<double>& solution, char source = ' ');
@@ -185,6 +213,9 @@ struct HighsMipSolverData {
     rowvals = ARvalue_.data() + start;
   }
 
+  double workUnits() const;
+  void updateTreeSizeEstimate();
+  double getEstimatedNodes() const;
   bool checkLimits(int64_t nodeOffset = 0) const;
   void limitsToBounds(double& dual_bound, double& primal_bound,
                       double& mip_rel_gap) const;
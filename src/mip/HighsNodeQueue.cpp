@@ -17,11 +17,32 @@
 #include "mip/HighsDomain.h"
 #include "mip/HighsLpRelaxation.h"
 #include "mip/HighsMipSolverData.h"
+#include "parallel/HighsCombinable.h"
+#include "parallel/HighsParallel.h"
+#include "pdqsort/pdqsort.h"
+#include "util/HighsHash.h"
 #include "util/HighsSplay.h"
 
 #define ESTIMATE_WEIGHT .5
 #define LOWERBOUND_WEIGHT .5
 
+// minimal number of columns for which the scan of the node queue against the
+// global bounds is split into tasks, and the number of columns per task
+constexpr HighsInt kMinColsForParallelPruning = 5000;
+constexpr HighsInt kParallelPruningGrainSize = 1000;
+
+// fraction of the node memory limit that spilling nodes to the temporary file
+// reduces the memory to, so that nodes are spilled in batches
+constexpr double kNodeMemorySpillTarget = 0.8;
+
+static bool seekSpillFile(std::FILE* file, int64_t position) {
+#ifdef _WIN32
+  return _fseeki64(file, position, SEEK_SET) == 0;
+#else
+  return fseeko(file, position, SEEK_SET) == 0;
+#endif
+}
+
 namespace highs {
 template <>
 struct RbTreeTraits<HighsNodeQueue::NodeLowerRbTree> {
@@ -61,7 +82,7 @@ class HighsNodeQueue::NodeLowerRbTree : public CacheMinRbTree<NodeLowerRbTree> {
   }
   std::tuple<double, HighsInt, double, int64_t> getKey(HighsInt node) const {
     return std::make_tuple(nodeQueue->nodes[node].lower_bound,
-                           HighsInt(nodeQueue->nodes[node].domchgstack.size()),
+                           nodeQueue->nodes[node].domchgStackSize(),
                            nodeQueue->nodes[node].estimate, node);
   }
 };
@@ -87,7 +108,7 @@ class HighsNodeQueue::NodeHybridEstimRbTree
     constexpr double kEstimWeight = 0.5;
     return std::make_tuple(kLbWeight * nodeQueue->nodes[node].lower_bound +
                                kEstimWeight * nodeQueue->nodes[node].estimate,
-                           -HighsInt(nodeQueue->nodes[node].domchgstack.size()),
+                           -nodeQueue->nodes[node].domchgStackSize(),
                            node);
   }
 };
@@ -130,12 +151,23 @@ void HighsNodeQueue::link_lower(int64_t node) {
   assert(node != -1);
   NodeLowerRbTree rbTree(this);
   rbTree.link(node);
+  if (nodes[node].lower_bound > -kHighsInf)
+    lowerBoundSum += nodes[node].lower_bound;
+  else
+    ++numInfiniteLowerBounds;
+  if (nodes[node].spillPosition == -1) ++numUnspilledLower;
 }
 
 void HighsNodeQueue::unlink_lower(int64_t node) {
   assert(node != -1);
   NodeLowerRbTree rbTree(this);
+  unlinkSpillCursor(rbTree, lowerSpillCursor, node);
   rbTree.unlink(node);
+  if (nodes[node].lower_bound > -kHighsInf)
+    lowerBoundSum -= nodes[node].lower_bound;
+  else
+    --numInfiniteLowerBounds;
+  if (nodes[node].spillPosition == -1) --numUnspilledLower;
 }
 
 void HighsNodeQueue::link_suboptimal(int64_t node) {
@@ -143,55 +175,164 @@ void HighsNodeQueue::link_suboptimal(int64_t node) {
   SuboptimalNodeRbTree rbTree(this);
   rbTree.link(node);
   ++numSuboptimal;
+  if (nodes[node].spillPosition == -1) ++numUnspilledSuboptimal;
 }
 
 void HighsNodeQueue::unlink_suboptimal(int64_t node) {
   assert(node != -1);
   SuboptimalNodeRbTree rbTree(this);
+  unlinkSpillCursor(rbTree, suboptimalSpillCursor, node);
   rbTree.unlink(node);
   --numSuboptimal;
+  if (nodes[node].spillPosition == -1) --numUnspilledSuboptimal;
+}
+
+template <typename RbTree>
+void HighsNodeQueue::unlinkSpillCursor(RbTree& rbTree, int64_t& cursor,
+                                       int64_t node) {
+  // the nodes after the cursor are spilled, so this still holds when the
+  // cursor moves to an adjacent node
+  if (node != cursor) return;
+  cursor = rbTree.predecessor(node);
+  if (cursor == -1) cursor = rbTree.successor(node);
 }
 
 void HighsNodeQueue::link_domchgs(int64_t node) {
   assert(node != -1);
-  HighsInt numchgs = nodes[node].domchgstack.size();
+  HighsInt numchgs = nodes[node].numDomchgs;
   nodes[node].domchglinks.resize(numchgs);
 
-  for (HighsInt i = 0; i != numchgs; ++i) {
-    double val = nodes[node].domchgstack[i].boundval;
-    HighsInt col = nodes[node].domchgstack[i].column;
-    switch (nodes[node].domchgstack[i].boundtype) {
+  // walk the stack of the node from its last domain change
+  int64_t entry = nodes[node].domchgTail;
+  for (HighsInt i = numchgs - 1; i >= 0; --i) {
+    const HighsDomainChange& domchg = domchgTree[entry].domchg;
+    switch (domchg.boundtype) {
       case HighsBoundType::kLower:
         nodes[node].domchglinks[i] =
-            colLowerNodesPtr.get()[col].emplace(val, node).first;
+            colLowerNodesPtr.get()[domchg.column]
+                .emplace(domchg.boundval, node)
+                .first;
         break;
       case HighsBoundType::kUpper:
         nodes[node].domchglinks[i] =
-            colUpperNodesPtr.get()[col].emplace(val, node).first;
+            colUpperNodesPtr.get()[domchg.column]
+                .emplace(domchg.boundval, node)
+                .first;
     }
+    entry = domchgTree[entry].parent;
   }
 }
 
 void HighsNodeQueue::unlink_domchgs(int64_t node) {
   assert(node != -1);
-  HighsInt numchgs = nodes[node].domchgstack.size();
+  if (nodes[node].domchglinks.empty()) return;
+  HighsInt numchgs = nodes[node].numDomchgs;
 
-  for (HighsInt i = 0; i != numchgs; ++i) {
-    HighsInt col = nodes[node].domchgstack[i].column;
-    switch (nodes[node].domchgstack[i].boundtype) {
+  int64_t entry = nodes[node].domchgTail;
+  for (HighsInt i = numchgs - 1; i >= 0; --i) {
+    const HighsDomainChange& domchg = domchgTree[entry].domchg;
+    switch (domchg.boundtype) {
       case HighsBoundType::kLower:
-        colLowerNodesPtr.get()[col].erase(nodes[node].domchglinks[i]);
+        colLowerNodesPtr.get()[domchg.column].erase(
+            nodes[node].domchglinks[i]);
         break;
       case HighsBoundType::kUpper:
-        colUpperNodesPtr.get()[col].erase(nodes[node].domchglinks[i]);
+        colUpperNodesPtr.get()[domchg.column].erase(
+            nodes[node].domchglinks[i]);
     }
+    entry = domchgTree[entry].parent;
   }
 
   nodes[node].domchglinks.clear();
   nodes[node].domchglinks.shrink_to_fit();
 }
 
+int64_t HighsNodeQueue::storeDomchgStack(
+    const std::vector<HighsDomainChange>& domchgstack) {
+  // the prefix that is shared with the stack of the last emplaced node
+  size_t numShared = std::min(domchgstack.size(), lastStackEntries.size());
+  for (size_t i = 0; i != numShared; ++i) {
+    if (domchgTree[lastStackEntries[i]].domchg != domchgstack[i]) {
+      numShared = i;
+      break;
+    }
+  }
+
+  int64_t lastTail = lastStackEntries.empty() ? -1 : lastStackEntries.back();
+  lastStackEntries.resize(numShared);
+  int64_t parent = numShared == 0 ? -1 : lastStackEntries.back();
+  for (size_t i = numShared; i != domchgstack.size(); ++i) {
+    int64_t entry;
+    if (freeDomchgTreeEntries.empty()) {
+      entry = domchgTree.size();
+      domchgTree.emplace_back();
+    } else {
+      entry = freeDomchgTreeEntries.back();
+      freeDomchgTreeEntries.pop_back();
+    }
+    domchgTree[entry].domchg = domchgstack[i];
+    domchgTree[entry].parent = parent;
+    domchgTree[entry].numRefs = 0;
+    if (parent != -1) ++domchgTree[parent].numRefs;
+    lastStackEntries.push_back(entry);
+    parent = entry;
+  }
+
+  // the node and the stored last stack both reference the tail. The reference
+  // to the previous last stack is released after the shared prefix has been
+  // referenced by the new entries
+  if (parent != -1) domchgTree[parent].numRefs += 2;
+  if (lastTail != -1) releaseDomchgTreeEntry(lastTail);
+
+  return parent;
+}
+
+void HighsNodeQueue::releaseDomchgTreeEntry(int64_t entry) {
+  while (entry != -1) {
+    assert(domchgTree[entry].numRefs > 0);
+    if (--domchgTree[entry].numRefs != 0) break;
+    freeDomchgTreeEntries.push_back(entry);
+    entry = domchgTree[entry].parent;
+  }
+}
+
+void HighsNodeQueue::getDomchgStack(
+    const OpenNode& node, std::vector<HighsDomainChange>& domchgstack) const {
+  domchgstack.resize(node.numDomchgs);
+  int64_t entry = node.domchgTail;
+  for (HighsInt i = node.numDomchgs - 1; i >= 0; --i) {
+    domchgstack[i] = domchgTree[entry].domchg;
+    entry = domchgTree[entry].parent;
+  }
+}
+
+void HighsNodeQueue::takeDomchgStack(int64_t node) {
+  OpenNode& openNode = nodes[node];
+  if (openNode.spillPosition != -1) {
+    readSpilledNode(openNode, openNode.domchgstack, openNode.branchings);
+    ++numSpillReads;
+  } else
+    getDomchgStack(openNode, openNode.domchgstack);
+}
+
+HighsNodeQueue::OpenNode HighsNodeQueue::copyNode(int64_t node) const {
+  OpenNode copy;
+  if (nodes[node].spillPosition != -1) {
+    readSpilledNode(nodes[node], copy.domchgstack, copy.branchings);
+  } else {
+    getDomchgStack(nodes[node], copy.domchgstack);
+    copy.branchings = nodes[node].branchings;
+  }
+  copy.numDomchgs = copy.domchgstack.size();
+  copy.lower_bound = nodes[node].lower_bound;
+  copy.estimate = nodes[node].estimate;
+  copy.depth = nodes[node].depth;
+  return copy;
+}
+
 double HighsNodeQueue::link(int64_t node) {
+  nodeMemory += nodeMemoryUsage(nodes[node]);
+
   if (nodes[node].lower_bound > optimality_limit) {
     assert(nodes[node].estimate != kHighsInf);
     nodes[node].estimate = kHighsInf;
@@ -215,6 +356,159 @@ void HighsNodeQueue::unlink(int64_t node) {
   }
   unlink_domchgs(node);
   freeslots.push(node);
+
+  OpenNode& openNode = nodes[node];
+  if (openNode.spillPosition == -1) {
+    nodeMemory -= nodeMemoryUsage(openNode);
+    releaseDomchgTreeEntry(openNode.domchgTail);
+    openNode.domchgTail = -1;
+  } else {
+    openNode.spillPosition = -1;
+    --numSpilled;
+    // the data of a popped node is read before anything is written to the
+    // file again, so the file can be reused from the start
+    if (numSpilled == 0) {
+      spillFileEnd = 0;
+      suboptimalSpillCursor = -1;
+      lowerSpillCursor = -1;
+      spillMemoryLimit = nodeMemoryLimit;
+    }
+  }
+}
+
+double HighsNodeQueue::nodeMemoryUsage(const OpenNode& node) {
+  // the domain changes are shared in the prefix tree, but each one is linked
+  // into the node set of its column for every node
+  constexpr double kDomchgLinkBytes = sizeof(NodeSet::iterator) +
+                                      sizeof(std::pair<double, int64_t>) +
+                                      4 * sizeof(void*);
+  return kDomchgLinkBytes * node.numDomchgs +
+         sizeof(HighsInt) * node.branchings.size();
+}
+
+void HighsNodeQueue::spillNode(int64_t node) {
+  OpenNode& openNode = nodes[node];
+  assert(openNode.spillPosition == -1);
+  getDomchgStack(openNode, openNode.domchgstack);
+  size_t numDomchgs = openNode.domchgstack.size();
+  size_t numBranchings = openNode.branchings.size();
+  bool written =
+      seekSpillFile(spillFile.get(), spillFileEnd) &&
+      std::fwrite(openNode.domchgstack.data(), sizeof(HighsDomainChange),
+                  numDomchgs, spillFile.get()) == numDomchgs &&
+      std::fwrite(openNode.branchings.data(), sizeof(HighsInt), numBranchings,
+                  spillFile.get()) == numBranchings;
+  std::vector<HighsDomainChange>().swap(openNode.domchgstack);
+  if (!written) {
+    // keep all nodes in memory if the file cannot be written
+    nodeMemoryLimit = kHighsInf;
+    spillMemoryLimit = kHighsInf;
+    return;
+  }
+
+  if (openNode.estimate == kHighsInf)
+    --numUnspilledSuboptimal;
+  else
+    --numUnspilledLower;
+
+  // the node is no longer found by the column node sets, so it is only pruned
+  // by the global bounds once it is loaded again
+  unlink_domchgs(node);
+  nodeMemory -= nodeMemoryUsage(openNode);
+  releaseDomchgTreeEntry(openNode.domchgTail);
+  openNode.domchgTail = -1;
+  openNode.spillPosition = spillFileEnd;
+  openNode.numSpilledBranchings = numBranchings;
+  spillFileEnd += sizeof(HighsDomainChange) * numDomchgs +
+                  sizeof(HighsInt) * numBranchings;
+  std::vector<HighsInt>().swap(openNode.branchings);
+  ++numSpilled;
+  ++numSpillWrites;
+}
+
+void HighsNodeQueue::spillColdNodes() {
+  if (!spillFile) {
+    spillFile.reset(std::tmpfile());
+    if (!spillFile) {
+      nodeMemoryLimit = kHighsInf;
+      spillMemoryLimit = kHighsInf;
+      return;
+    }
+  }
+
+  const double targetMemory = kNodeMemorySpillTarget * nodeMemoryLimit;
+
+  // suboptimal nodes are spilled first, then the nodes with the largest lower
+  // bounds
+  SuboptimalNodeRbTree suboptimalTree(this);
+  spillNodesFromCursor(suboptimalTree, suboptimalSpillCursor,
+                       numUnspilledSuboptimal, targetMemory);
+  NodeLowerRbTree lowerTree(this);
+  spillNodesFromCursor(lowerTree, lowerSpillCursor, numUnspilledLower,
+                       targetMemory);
+
+  // the memory of the domain changes that are shared with the last emplaced
+  // node cannot be spilled, and when it exceeds the target the limit is
+  // raised so that nodes are not spilled again on every emplace
+  spillMemoryLimit = std::max(nodeMemoryLimit,
+                              totalNodeMemory() / kNodeMemorySpillTarget);
+}
+
+template <typename RbTree>
+void HighsNodeQueue::spillNodesFromCursor(RbTree& rbTree, int64_t& cursor,
+                                          const int64_t& numUnspilled,
+                                          double targetMemory) {
+  // the nodes after the cursor are already spilled unless they were moved
+  // between the trees, so they are only walked again when no unspilled node
+  // is left before the cursor
+  bool fromLast = cursor == -1;
+  int64_t node = fromLast ? rbTree.last() : cursor;
+  while (numUnspilled != 0 && totalNodeMemory() > targetMemory &&
+         nodeMemoryLimit != kHighsInf) {
+    if (node == -1) {
+      if (fromLast) break;
+      fromLast = true;
+      node = rbTree.last();
+      continue;
+    }
+    if (nodes[node].spillPosition == -1) spillNode(node);
+    cursor = node;
+    node = rbTree.predecessor(node);
+  }
+}
+
+bool HighsNodeQueue::linkedAfterSpillCursor(int64_t node) {
+  if (nodes[node].estimate == kHighsInf) {
+    if (suboptimalSpillCursor == -1) return false;
+    SuboptimalNodeRbTree rbTree(this);
+    return rbTree.getKey(suboptimalSpillCursor) < rbTree.getKey(node);
+  }
+
+  if (lowerSpillCursor == -1) return false;
+  NodeLowerRbTree rbTree(this);
+  return rbTree.getKey(lowerSpillCursor) < rbTree.getKey(node);
+}
+
+bool HighsNodeQueue::readSpilledNode(
+    const OpenNode& node, std::vector<HighsDomainChange>& domchgstack,
+    std::vector<HighsInt>& branchings) const {
+  assert(node.spillPosition != -1);
+  domchgstack.resize(node.numDomchgs);
+  branchings.resize(node.numSpilledBranchings);
+  if (seekSpillFile(spillFile.get(), node.spillPosition) &&
+      std::fread(domchgstack.data(), sizeof(HighsDomainChange),
+                 domchgstack.size(),
+                 spillFile.get()) == domchgstack.size() &&
+      std::fread(branchings.data(), sizeof(HighsInt), branchings.size(),
+                 spillFile.get()) == branchings.size())
+    return true;
+
+  // without its domain changes the node covers a larger part of the search
+  // space than it was created for, so the error stops the solve
+  spillReadError = true;
+  domchgstack.clear();
+  branchings.clear();
+  return false;
 }
 
 void HighsNodeQueue::setNumCol(HighsInt numCol) {
@@ -238,26 +532,59 @@ void HighsNodeQueue::setNumCol(HighsInt numCol) {
 void HighsNodeQueue::checkGlobalBounds(HighsInt col, double lb, double ub,
                                        double feastol,
                                        HighsCDouble& treeweight) {
-  std::set<int64_t> delnodes;
+  std::vector<int64_t> delnodes;
+  collectInfeasibleNodes(col, lb, ub, feastol, delnodes);
+  pruneNodes(delnodes, treeweight);
+}
+
+void HighsNodeQueue::pruneNodes(std::vector<int64_t>& delnodes,
+                                HighsCDouble& treeweight) {
+  pdqsort(delnodes.begin(), delnodes.end());
+  delnodes.erase(std::unique(delnodes.begin(), delnodes.end()),
+                 delnodes.end());
+
+  for (int64_t delnode : delnodes) {
+    if (nodes[delnode].estimate != kHighsInf)
+      treeweight += std::ldexp(1.0, 1 - nodes[delnode].depth);
+    unlink(delnode);
+  }
+}
+
+void HighsNodeQueue::pruneNodes(
+    std::vector<std::pair<HighsInt, int64_t>>& delnodes,
+    HighsCDouble& treeweight) {
+  // sorting by column and node gives the order in which the serial scan
+  // unlinks the nodes, except that a node found for several columns is only
+  // unlinked for the first of them, since the serial scan no longer finds it
+  // in the node sets of the later columns
+  pdqsort(delnodes.begin(), delnodes.end());
+  delnodes.erase(std::unique(delnodes.begin(), delnodes.end()),
+                 delnodes.end());
+
+  HighsHashTable<int64_t> unlinked;
+  for (const std::pair<HighsInt, int64_t>& delnode : delnodes) {
+    if (!unlinked.insert(delnode.second)) continue;
+    if (nodes[delnode.second].estimate != kHighsInf)
+      treeweight += std::ldexp(1.0, 1 - nodes[delnode.second].depth);
+    unlink(delnode.second);
+  }
+}
 
+void HighsNodeQueue::collectInfeasibleNodes(
+    HighsInt col, double lb, double ub, double feastol,
+    std::vector<int64_t>& delnodes) const {
   auto colLowerNodes = colLowerNodesPtr.get();
   auto colUpperNodes = colUpperNodesPtr.get();
 
   auto prunestart =
       colLowerNodes[col].lower_bound(std::make_pair(ub + feastol, -1));
   for (auto it = prunestart; it != colLowerNodes[col].end(); ++it)
-    delnodes.insert(it->second);
+    delnodes.push_back(it->second);
 
   auto pruneend =
       colUpperNodes[col].upper_bound(std::make_pair(lb - feastol, kHighsIInf));
   for (auto it = colUpperNodes[col].begin(); it != pruneend; ++it)
-    delnodes.insert(it->second);
-
-  for (int64_t delnode : delnodes) {
-    if (nodes[delnode].estimate != kHighsInf)
-      treeweight += std::ldexp(1.0, 1 - nodes[delnode].depth);
-    unlink(delnode);
-  }
+    delnodes.push_back(it->second);
 }
 
 double HighsNodeQueue::pruneInfeasibleNodes(HighsDomain& globaldomain,
@@ -266,6 +593,9 @@ double HighsNodeQueue::pruneInfeasibleNodes(HighsDomain& globaldomain,
 
   HighsCDouble treeweight = 0.0;
 
+  const bool parallelScan = numCol >= kMinColsForParallelPruning &&
+                            highs::parallel::num_threads() > 1;
+
   do {
     if (globaldomain.infeasible()) break;
 
@@ -273,9 +603,43 @@ double HighsNodeQueue::pruneInfeasibleNodes(HighsDomain& globaldomain,
 
     assert(numCol == (HighsInt)globaldomain.col_lower_.size());
 
-    for (HighsInt i = 0; i < numCol; ++i) {
-      checkGlobalBounds(i, globaldomain.col_lower_[i],
-                        globaldomain.col_upper_[i], feastol, treeweight);
+    if (parallelScan && numNodes() != 0) {
+      // the scan over the columns only reads the node sets, so it is split
+      // into tasks. The collected nodes are then unlinked column by column in
+      // the same order as by checkGlobalBounds() in the serial scan, so the
+      // state of the node queue does not depend on the path taken
+      auto threadDelNodes =
+          makeHighsCombinable<std::vector<std::pair<HighsInt, int64_t>>>(
+              []() { return std::vector<std::pair<HighsInt, int64_t>>(); });
+      highs::parallel::for_each(
+          0, numCol,
+          [&](HighsInt start, HighsInt end) {
+            std::vector<std::pair<HighsInt, int64_t>>& localDelNodes =
+                threadDelNodes.local();
+            std::vector<int64_t> colDelNodes;
+            for (HighsInt i = start; i < end; ++i) {
+              colDelNodes.clear();
+              collectInfeasibleNodes(i, globaldomain.col_lower_[i],
+                                     globaldomain.col_upper_[i], feastol,
+                                     colDelNodes);
+              for (int64_t delnode : colDelNodes)
+                localDelNodes.emplace_back(i, delnode);
+            }
+          },
+          kParallelPruningGrainSize);
+
+      std::vector<std::pair<HighsInt, int64_t>> delnodes;
+      threadDelNodes.combine_each(
+          [&](std::vector<std::pair<HighsInt, int64_t>>& localDelNodes) {
+            delnodes.insert(delnodes.end(), localDelNodes.begin(),
+                            localDelNodes.end());
+          });
+      pruneNodes(delnodes, treeweight);
+    } else {
+      for (HighsInt i = 0; i < numCol; ++i) {
+        checkGlobalBounds(i, globaldomain.col_lower_[i],
+                          globaldomain.col_upper_[i], feastol, treeweight);
+      }
     }
 
     size_t numopennodes = numNodes();
@@ -384,12 +748,23 @@ double HighsNodeQueue::emplaceNode(std::vector<HighsDomainChange>&& domchgs,
   assert(nodes[pos].estimate == estimate);
   assert(nodes[pos].depth == depth);
 
-  return link(pos);
+  // the domain changes are kept in the prefix tree while the node is queued
+  nodes[pos].domchgTail = storeDomchgStack(nodes[pos].domchgstack);
+  std::vector<HighsDomainChange>().swap(nodes[pos].domchgstack);
+
+  double treeweight = link(pos);
+  if (linkedAfterSpillCursor(pos))
+    spillNode(pos);
+  else if (totalNodeMemory() > spillMemoryLimit)
+    spillColdNodes();
+
+  return treeweight;
 }
 
 HighsNodeQueue::OpenNode&& HighsNodeQueue::popBestNode() {
   int64_t bestNode = hybridEstimMin;
 
+  takeDomchgStack(bestNode);
   unlink(bestNode);
 
   return std::move(nodes[bestNode]);
@@ -398,6 +773,7 @@ HighsNodeQueue::OpenNode&& HighsNodeQueue::popBestNode() {
 HighsNodeQueue::OpenNode&& HighsNodeQueue::popBestBoundNode() {
   int64_t bestBoundNode = lowerMin;
 
+  takeDomchgStack(bestBoundNode);
   unlink(bestBoundNode);
 
   return std::move(nodes[bestBoundNode]);
@@ -411,14 +787,22 @@ double HighsNodeQueue::getBestLowerBound() const {
   return std::min(nodes[suboptimalMin].lower_bound, lb);
 }
 
+double HighsNodeQueue::getSubtreeGapSum(double upper_limit) const {
+  // the gap of a node without a finite lower bound is infinite
+  if (upper_limit == kHighsInf || numInfiniteLowerBounds != 0)
+    return kHighsInf;
+
+  HighsCDouble gapSum = upper_limit * double(numActiveNodes());
+  gapSum -= lowerBoundSum;
+  return std::max(double(gapSum), 0.0);
+}
+
 HighsInt HighsNodeQueue::getBestBoundDomchgStackSize() const {
-  HighsInt domchgStackSize = lowerMin == -1
-                                 ? kHighsIInf
-                                 : HighsInt(nodes[lowerMin].domchgstack.size());
+  HighsInt domchgStackSize =
+      lowerMin == -1 ? kHighsIInf : nodes[lowerMin].domchgStackSize();
   if (suboptimalMin == -1) return domchgStackSize;
 
-  return std::min(HighsInt(nodes[suboptimalMin].domchgstack.size()),
-                  domchgStackSize);
+  return std::min(nodes[suboptimalMin].domchgStackSize(), domchgStackSize);
 }
 
 void HighsNodeQueue::clear() {
@@ -440,7 +824,20 @@ void HighsNodeQueue::clear() {
     (*this).suboptimalRoot = nodequeue.suboptimalRoot;
     (*this).suboptimalMin = nodequeue.suboptimalMin;
     (*this).numSuboptimal = nodequeue.numSuboptimal;
+    (*this).lowerBoundSum = nodequeue.lowerBoundSum;
+    (*this).numInfiniteLowerBounds = nodequeue.numInfiniteLowerBounds;
     (*this).optimality_limit = nodequeue.optimality_limit;
     (*this).numCol = nodequeue.numCol;
+    (*this).spillFileEnd = 0;
+    (*this).numSpilled = 0;
+    (*this).nodeMemory = 0.0;
+    (*this).spillMemoryLimit = nodeMemoryLimit;
+    (*this).suboptimalSpillCursor = -1;
+    (*this).lowerSpillCursor = -1;
+    (*this).numUnspilledSuboptimal = 0;
+    (*this).numUnspilledLower = 0;
+    (*this).domchgTree.clear();
+    (*this).freeDomchgTreeEntries.clear();
+    (*this).lastStackEntries.clear();
   }
 }
@@ -14,6 +14,7 @@
 
 #include <cassert>
 #include <cstddef>
+#include <cstdio>
 #include <memory>
 #include <queue>
 #include <set>
@@ -22,6 +23,7 @@
 #include "lp_data/HConst.h"
 #include "mip/HighsDomainChange.h"
 #include "util/HighsCDouble.h"
+#include "util/HighsNodesetAllocator.h"
 #include "util/HighsRbTree.h"
 
 class HighsDomain;
@@ -29,111 +31,10 @@ class HighsLpRelaxation;
 
 class HighsNodeQueue {
  public:
-  template <int S>
-  struct ChunkWithSize {
-    ChunkWithSize* next;
-    typename std::aligned_storage<S, alignof(std::max_align_t)>::type storage;
-  };
-
-  using Chunk =
-      ChunkWithSize<4096 - offsetof(ChunkWithSize<sizeof(void*)>, storage)>;
-
-  struct AllocatorState {
-    void* freeListHead = nullptr;
-    char* currChunkStart = nullptr;
-    char* currChunkEnd = nullptr;
-    Chunk* chunkListHead = nullptr;
-
-    AllocatorState() = default;
-    AllocatorState(const AllocatorState&) = delete;
-    AllocatorState(AllocatorState&& other)
-        : freeListHead(other.freeListHead),
-          currChunkStart(other.currChunkStart),
-          currChunkEnd(other.currChunkEnd),
-          chunkListHead(other.chunkListHead) {
-      other.chunkListHead = nullptr;
-    }
-
-    AllocatorState& operator=(const AllocatorState&) = delete;
-
-    AllocatorState& operator=(AllocatorState&& other) {
-      freeListHead = other.freeListHead;
-      currChunkStart = other.currChunkStart;
-      currChunkEnd = other.currChunkEnd;
-      chunkListHead = other.chunkListHead;
-
-      other.chunkListHead = nullptr;
-      return *this;
-    }
-
-    ~AllocatorState() {
-      while (chunkListHead) {
-        Chunk* delChunk = chunkListHead;
-        chunkListHead = delChunk->next;
-        delete delChunk;
-      }
-    }
-  };
+  using AllocatorState = HighsNodesetAllocatorState;
 
   template <typename T>
-  class NodesetAllocator {
-    union FreelistNode {
-      FreelistNode* next;
-      typename std::aligned_storage<sizeof(T), alignof(T)>::type storage;
-    };
-
-   public:
-    AllocatorState* state;
-    using value_type = T;
-    using size_type = std::size_t;
-    using propagate_on_container_move_assignment = std::true_type;
-
-    NodesetAllocator(AllocatorState* state) : state(state) {}
-    NodesetAllocator(const NodesetAllocator& other) noexcept = default;
-    template <typename U>
-    NodesetAllocator(const NodesetAllocator<U>& other) noexcept
-        : state(other.state) {}
-    NodesetAllocator(NodesetAllocator&& other) noexcept = default;
-    NodesetAllocator& operator=(const NodesetAllocator&) noexcept = default;
-    NodesetAllocator& operator=(NodesetAllocator&& other) noexcept = default;
-    ~NodesetAllocator() noexcept = default;
-
-    T* allocate(size_type n) {
-      if (n == 1) {
-        T* ptr = reinterpret_cast<T*>(state->freeListHead);
-        if (ptr) {
-          state->freeListHead =
-              reinterpret_cast<FreelistNode*>(state->freeListHead)->next;
-        } else {
-          ptr = reinterpret_cast<T*>(state->currChunkStart);
-          state->currChunkStart += sizeof(FreelistNode);
-          if (state->currChunkStart > state->currChunkEnd) {
-            auto newChunk = new Chunk;
-            newChunk->next = state->chunkListHead;
-            state->chunkListHead = newChunk;
-            state->currChunkStart = reinterpret_cast<char*>(&newChunk->storage);
-            state->currChunkEnd =
-                state->currChunkStart + sizeof(newChunk->storage);
-            ptr = reinterpret_cast<T*>(state->currChunkStart);
-            state->currChunkStart += sizeof(FreelistNode);
-          }
-        }
-        return ptr;
-      }
-
-      return static_cast<T*>(::operator new(n * sizeof(T)));
-    }
-
-    void deallocate(T* ptr, size_type n) noexcept {
-      if (n == 1) {
-        FreelistNode* node = reinterpret_cast<FreelistNode*>(ptr);
-        node->next = reinterpret_cast<FreelistNode*>(state->freeListHead);
-        state->freeListHead = node;
-      } else {
-        ::operator delete(ptr);
-      }
-    }
-  };
+  using NodesetAllocator = HighsNodesetAllocator<T>;
 
   using NodeSet = std::set<std::pair<double, int64_t>,
                            std::less<std::pair<double, int64_t>>,
@@ -148,6 +49,15 @@ class HighsNodeQueue {
     HighsInt depth;
     highs::RbTreeLinks<int64_t> lowerLinks;
     highs::RbTreeLinks<int64_t> hybridEstimLinks;
+    // while the node is in the queue its domain changes are stored in the
+    // prefix tree of the queue and the node references the entry of its last
+    // domain change
+    int64_t domchgTail;
+    HighsInt numDomchgs;
+    // position of the domain changes and branching positions in the spill
+    // file for nodes that were moved there, -1 otherwise
+    int64_t spillPosition;
+    HighsInt numSpilledBranchings;
 
     OpenNode()
         : domchgstack(),
@@ -157,7 +67,11 @@ class HighsNodeQueue {
           estimate(-kHighsInf),
           depth(0),
           lowerLinks(),
-          hybridEstimLinks() {}
+          hybridEstimLinks(),
+          domchgTail(-1),
+          numDomchgs(0),
+          spillPosition(-1),
+          numSpilledBranchings(0) {}
 
     OpenNode(std::vector<HighsDomainChange>&& domchgstack,
              std::vector<HighsInt>&& branchings, double lower_bound,
@@ -168,7 +82,13 @@ class HighsNodeQueue {
           estimate(estimate),
           depth(depth),
           lowerLinks(),
-          hybridEstimLinks() {}
+          hybridEstimLinks(),
+          domchgTail(-1),
+          numDomchgs(this->domchgstack.size()),
+          spillPosition(-1),
+          numSpilledBranchings(0) {}
+
+    HighsInt domchgStackSize() const { return numDomchgs; }
 
     OpenNode& operator=(OpenNode&& other) = default;
     OpenNode(OpenNode&&) = default;
@@ -180,6 +100,10 @@ class HighsNodeQueue {
   void checkGlobalBounds(HighsInt col, double lb, double ub, double feastol,
                          HighsCDouble& treeweight);
 
+  void collectInfeasibleNodes(HighsInt col, double lb, double ub,
+                              double feastol,
+                              std::vector<int64_t>& delnodes) const;
+
  private:
   class NodeLowerRbTree;
   class NodeHybridEstimRbTree;
@@ -206,9 +130,88 @@ class HighsNodeQueue {
   int64_t suboptimalRoot = -1;
   int64_t suboptimalMin = -1;
   int64_t numSuboptimal = 0;
+  // sum of the finite lower bounds of the nodes in the lower bound tree, and
+  // number of nodes in it whose lower bound is minus infinity
+  HighsCDouble lowerBoundSum = 0.0;
+  int64_t numInfiniteLowerBounds = 0;
   double optimality_limit = kHighsInf;
   HighsInt numCol = 0;
 
+  struct SpillFileClose {
+    void operator()(std::FILE* file) const { std::fclose(file); }
+  };
+  std::unique_ptr<std::FILE, SpillFileClose> spillFile;
+  int64_t spillFileEnd = 0;
+  int64_t numSpilled = 0;
+  // numbers of nodes written to and read back from the spill file in total
+  int64_t numSpillWrites = 0;
+  int64_t numSpillReads = 0;
+  mutable bool spillReadError = false;
+  double nodeMemory = 0.0;
+  double nodeMemoryLimit = kHighsInf;
+  // limit above which nodes are spilled, which is raised above the node
+  // memory limit when the memory of the nodes that are kept cannot be reduced
+  // below it
+  double spillMemoryLimit = kHighsInf;
+  // the nodes after the cursors in the suboptimal and lower bound trees are
+  // spilled, so that spilling continues at the cursors. Nodes that are linked
+  // after a cursor are spilled right away
+  int64_t suboptimalSpillCursor = -1;
+  int64_t lowerSpillCursor = -1;
+  int64_t numUnspilledSuboptimal = 0;
+  int64_t numUnspilledLower = 0;
+
+  // prefix tree of the domain change stacks of the open nodes. Each entry holds
+  // one domain change and the entry of the preceding change, and counts the
+  // entries and nodes that reference it
+  struct DomchgTreeEntry {
+    HighsDomainChange domchg;
+    int64_t parent;
+    HighsInt numRefs;
+  };
+  std::vector<DomchgTreeEntry> domchgTree;
+  std::vector<int64_t> freeDomchgTreeEntries;
+  // entries of the stack of the last emplaced node, which holds a reference to
+  // the last one. Nodes are emplaced along the path of a dive, so the stack of
+  // the next node shares a prefix with it
+  std::vector<int64_t> lastStackEntries;
+
+  int64_t storeDomchgStack(const std::vector<HighsDomainChange>& domchgstack);
+
+  void releaseDomchgTreeEntry(int64_t entry);
+
+  void getDomchgStack(const OpenNode& node,
+                      std::vector<HighsDomainChange>& domchgstack) const;
+
+  void takeDomchgStack(int64_t node);
+
+  double totalNodeMemory() const {
+    return nodeMemory + sizeof(DomchgTreeEntry) *
+                            double(domchgTree.size() -
+                                   freeDomchgTreeEntries.size());
+  }
+
+  static double nodeMemoryUsage(const OpenNode& node);
+
+  void spillNode(int64_t node);
+
+  void spillColdNodes();
+
+  template <typename RbTree>
+  void spillNodesFromCursor(RbTree& rbTree, int64_t& cursor,
+                            const int64_t& numUnspilled, double targetMemory);
+
+  bool linkedAfterSpillCursor(int64_t node);
+
+  template <typename RbTree>
+  void unlinkSpillCursor(RbTree& rbTree, int64_t& cursor, int64_t node);
+
+  bool readSpilledNode(const OpenNode& node,
+                       std::vector<HighsDomainChange>& domchgstack,
+                       std::vector<HighsInt>& branchings) const;
+
+  OpenNode copyNode(int64_t node) const;
+
   void link_estim(int64_t node);
 
   void unlink_estim(int64_t node);
@@ -229,11 +232,36 @@ class HighsNodeQueue {
 
   void unlink(int64_t node);
 
+  void pruneNodes(std::vector<int64_t>& delnodes, HighsCDouble& treeweight);
+
+  void pruneNodes(std::vector<std::pair<HighsInt, int64_t>>& delnodes,
+                  HighsCDouble& treeweight);
+
  public:
   void setOptimalityLimit(double optimality_limit) {
     this->optimality_limit = optimality_limit;
   }
 
+  /// sets the limit in bytes on the estimated memory for the domain changes
+  /// of the open nodes. Above the limit the domain changes of the nodes with
+  /// the largest lower bounds are moved to a temporary file until they are
+  /// popped
+  void setNodeMemoryLimit(double nodeMemoryLimit) {
+    this->nodeMemoryLimit = nodeMemoryLimit;
+    spillMemoryLimit = nodeMemoryLimit;
+  }
+
+  int64_t numSpilledNodes() const { return numSpilled; }
+
+  int64_t getNumSpillWrites() const { return numSpillWrites; }
+
+  int64_t getNumSpillReads() const { return numSpillReads; }
+
+  /// whether the domain changes of a node could not be read back from the
+  /// spill file, in which case the node covers a larger part of the search
+  /// space than it was created for
+  bool hasSpillReadError() const { return spillReadError; }
+
   double performBounding(double upper_limit);
 
   void setNumCol(HighsInt numcol);
@@ -284,6 +312,11 @@ class HighsNodeQueue {
 
   double getBestLowerBound() const;
 
+  /// sum of the gaps between the upper limit and the lower bounds of the open
+  /// nodes that are not suboptimal, which is infinite when one of them has no
+  /// finite lower bound
+  double getSubtreeGapSum(double upper_limit) const;
+
   HighsInt getBestBoundDomchgStackSize() const;
 
   void clear();
@@ -295,18 +328,21 @@ class HighsNodeQueue {
   }
 
   bool empty() const { return numActiveNodes() == 0; }
-};
 
-template <typename T, typename U>
-bool operator==(const HighsNodeQueue::NodesetAllocator<T>&,
-                const HighsNodeQueue::NodesetAllocator<U>&) {
-  return true;
-}
-
-template <typename T, typename U>
-bool operator!=(const HighsNodeQueue::NodesetAllocator<T>&,
-                const HighsNodeQueue::NodesetAllocator<U>&) {
-  return false;
-}
+  /// calls f with a copy of each open node that is not suboptimal in the
+  /// order of the node slots
+  template <typename F>
+  void forEachActiveNode(F&& f) const {
+    auto slots = freeslots;
+    for (int64_t i = 0; i != (int64_t)nodes.size(); ++i) {
+      if (!slots.empty() && slots.top() == i) {
+        slots.pop();
+        continue;
+      }
+      if (nodes[i].estimate == kHighsInf) continue;
+      f(copyNode(i));
+    }
+  }
+};
 
 #endif
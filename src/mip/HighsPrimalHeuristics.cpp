@@ -34,19 +34,86 @@
 #define FP_32BIT_VOLATILE
 #endif
 
+// number of incumbents kept for the crossover neighbourhood
+constexpr size_t kAlnsPoolSize = 10;
+// minimal fraction of the integer columns that a neighbourhood must fix
+constexpr double kAlnsMinFixingRate = 0.25;
+// maximal number of binary columns that flip in the local branching
+// neighbourhood
+constexpr HighsInt kAlnsLocalBranchingSize = 10;
+// LP iterations that count as one unit of effort, the number of recent calls
+// that the reward of a neighbourhood is averaged over, and the weight of the
+// exploration term of the upper confidence bound
+constexpr double kAlnsEffortUnit = 1000.0;
+constexpr HighsInt kAlnsRewardWindow = 10;
+constexpr double kAlnsExploration = 0.3;
+
+// A sub-MIP solved on a separate task. All data read by the sub-MIP is owned
+// by this struct, so that the main search can modify the clique table,
+// implications and pseudocosts while the sub-MIP runs.
+struct HighsPrimalHeuristics::BackgroundSubMip {
+  HighsLp submip;
+  HighsOptions options;
+  HighsBasis basis;
+  HighsCallback callback;
+  HighsSolution solution;
+  HighsPseudocostInitialization pscostinit;
+  HighsCliqueTable cliquetable;
+  HighsImplications implications;
+  double fixingRate;
+  double numUnfixed;
+  // repeats the heuristic with a lower fixing rate when the sub-MIP is
+  // infeasible in its root node
+  std::function<void()> retry;
+  HighsMipSolver submipsolver;
+  // declared last so that the task is finished before the data is destroyed
+  highs::parallel::TaskGroup taskGroup;
+
+  BackgroundSubMip(const HighsMipSolver& mipsolver, HighsLp&& lp,
+                   HighsOptions&& submipoptions, const HighsBasis& rootbasis,
+                   double fixingRate)
+      : submip(std::move(lp)),
+        options(std::move(submipoptions)),
+        basis(rootbasis),
+        pscostinit(mipsolver.mipdata_->pseudocost, 1),
+        cliquetable(submip.num_col_),
+        implications(mipsolver.mipdata_->implications),
+        fixingRate(fixingRate),
+        numUnfixed(mipsolver.mipdata_->integral_cols.size() +
+                   mipsolver.mipdata_->continuous_cols.size()),
+        submipsolver(callback, options, submip, solution, true) {
+    callback.clear();
+    cliquetable.buildFrom(&submip, mipsolver.mipdata_->cliquetable);
+    submipsolver.rootbasis = &basis;
+    submipsolver.pscostinit = &pscostinit;
+    submipsolver.clqtableinit = &cliquetable;
+    submipsolver.implicinit = &implications;
+  }
+};
+
 HighsPrimalHeuristics::HighsPrimalHeuristics(HighsMipSolver& mipsolver)
     : mipsolver(mipsolver),
       lp_iterations(0),
-      randgen(mipsolver.options_mip_->random_seed) {
+      randgen(mipsolver.options_mip_->random_seed),
+      subMipsInBackground(false),
+      numAlnsCalls(0),
+      numAlnsSuccesses(0) {
   successObservations = 0;
   numSuccessObservations = 0;
   infeasObservations = 0;
   numInfeasObservations = 0;
 }
 
+HighsPrimalHeuristics::~HighsPrimalHeuristics() = default;
+
 void HighsPrimalHeuristics::setupIntCols() {
   intcols = mipsolver.mipdata_->integer_cols;
 
+  // solutions of an earlier run are in the space of a different model
+  solutionPool.clear();
+  if (!mipsolver.mipdata_->incumbent.empty())
+    solutionPool.push_back(mipsolver.mipdata_->incumbent);
+
   pdqsort(intcols.begin(), intcols.end(), [&](HighsInt c1, HighsInt c2) {
     const FP_32BIT_VOLATILE double lockScore1 =
         (mipsolver.mipdata_->feastol + mipsolver.mipdata_->uplocks[c1]) *
@@ -78,10 +145,11 @@ void HighsPrimalHeuristics::setupIntCols() {
   });
 }
 
-bool HighsPrimalHeuristics::solveSubMip(
+HighsPrimalHeuristics::SubMipResult HighsPrimalHeuristics::solveSubMip(
     const HighsLp& lp, const HighsBasis& basis, double fixingRate,
     std::vector<double> colLower, std::vector<double> colUpper,
-    HighsInt maxleaves, HighsInt maxnodes, HighsInt stallnodes) {
+    HighsInt maxleaves, HighsInt maxnodes, HighsInt stallnodes,
+    bool objectiveCutoff) {
   HighsOptions submipoptions = *mipsolver.options_mip_;
   HighsLp submip = lp;
 
@@ -109,7 +177,18 @@ bool HighsPrimalHeuristics::solveSubMip(
   submipoptions.mip_pscost_minreliable = 0;
   submipoptions.time_limit -=
       mipsolver.timer_.read(mipsolver.timer_.solve_clock);
-  submipoptions.objective_bound = mipsolver.mipdata_->upper_limit;
+  if (submipoptions.mip_max_work_units != kHighsInf)
+    submipoptions.mip_max_work_units =
+        std::max(0.0, submipoptions.mip_max_work_units -
+                          mipsolver.mipdata_->workUnits());
+  if (objectiveCutoff) {
+    submipoptions.objective_bound = mipsolver.mipdata_->upper_limit;
+  } else {
+    // the sub-MIP has a different objective, which the limits of the MIP do
+    // not apply to
+    submipoptions.objective_bound = kHighsInf;
+    submipoptions.objective_target = -kHighsInf;
+  }
 
   if (!mipsolver.submip) {
     double curr_abs_gap =
@@ -130,6 +209,15 @@ bool HighsPrimalHeuristics::solveSubMip(
   submipoptions.mip_heuristic_effort = 0.8;
   // setup solver and run it
 
+  if (subMipsInBackground && !backgroundSubMip) {
+    BackgroundSubMip* job =
+        new BackgroundSubMip(mipsolver, std::move(submip),
+                             std::move(submipoptions), basis, fixingRate);
+    backgroundSubMip = std::unique_ptr<BackgroundSubMip>(job);
+    job->taskGroup.spawn([job]() { job->submipsolver.run(); });
+    return SubMipResult::kDeferred;
+  }
+
   HighsSolution solution;
   solution.value_valid = false;
   solution.dual_valid = false;
@@ -142,9 +230,18 @@ bool HighsPrimalHeuristics::solveSubMip(
   submipsolver.clqtableinit = &mipsolver.mipdata_->cliquetable;
   submipsolver.implicinit = &mipsolver.mipdata_->implications;
   submipsolver.run();
+
+  if (!processSubMipResult(submipsolver, fixingRate,
+                           mipsolver.mipdata_->integral_cols.size() +
+                               mipsolver.mipdata_->continuous_cols.size()))
+    return SubMipResult::kInfeasible;
+
+  return SubMipResult::kSolved;
+}
+
+bool HighsPrimalHeuristics::processSubMipResult(
+    const HighsMipSolver& submipsolver, double fixingRate, double numUnfixed) {
   if (submipsolver.mipdata_) {
-    double numUnfixed = mipsolver.mipdata_->integral_cols.size() +
-                        mipsolver.mipdata_->continuous_cols.size();
     double adjustmentfactor = submipsolver.numCol() / std::max(1.0, numUnfixed);
     // (double)mipsolver.orig_model_->a_matrix_.value_.size();
     int64_t adjusted_lp_iterations =
@@ -156,7 +253,9 @@ bool HighsPrimalHeuristics::solveSubMip(
           int64_t{1}, int64_t(adjustmentfactor * submipsolver.node_count_));
   }
 
-  if (submipsolver.modelstatus_ == HighsModelStatus::kInfeasible) {
+  // sub-MIPs without fixings give no observations for the fixing rate
+  if (fixingRate > 0.0 &&
+      submipsolver.modelstatus_ == HighsModelStatus::kInfeasible) {
     infeasObservations += fixingRate;
     ++numInfeasObservations;
   }
@@ -169,7 +268,8 @@ bool HighsPrimalHeuristics::solveSubMip(
     mipsolver.mipdata_->trySolution(submipsolver.solution_, 'L');
   }
 
-  if (mipsolver.mipdata_->numImprovingSols != oldNumImprovingSols) {
+  if (fixingRate > 0.0 &&
+      mipsolver.mipdata_->numImprovingSols != oldNumImprovingSols) {
     // remember fixing rate as good
     successObservations += fixingRate;
     ++numSuccessObservations;
@@ -178,6 +278,30 @@ bool HighsPrimalHeuristics::solveSubMip(
   return true;
 }
 
+void HighsPrimalHeuristics::finishBackgroundSubMip() {
+  if (!backgroundSubMip) return;
+
+  // the result is always used at this point, independent of when the task
+  // finished, so that the search stays deterministic
+  backgroundSubMip->taskGroup.sync();
+  bool feasible = processSubMipResult(backgroundSubMip->submipsolver,
+                                      backgroundSubMip->fixingRate,
+                                      backgroundSubMip->numUnfixed);
+  std::function<void()> retry = std::move(backgroundSubMip->retry);
+  backgroundSubMip.reset();
+
+  // as for a sub-MIP that is not solved in the background, the heuristic is
+  // repeated with a lower fixing rate when the sub-MIP is infeasible in its
+  // root node
+  if (!feasible && retry && !mipsolver.mipdata_->checkLimits()) {
+    highsLogDev(mipsolver.options_mip_->log_options, HighsLogType::kInfo,
+                "Background sub-MIP infeasible in its root node, repeating "
+                "the heuristic with a lower fixing rate\n");
+    retry();
+  }
+  flushStatistics();
+}
+
 double HighsPrimalHeuristics::determineTargetFixingRate() {
   double lowFixingRate = 0.6;
   double highFixingRate = 0.6;
@@ -295,7 +419,8 @@ void HighsPrimalHeuristics::rootReducedCost() {
               200 + mipsolver.mipdata_->num_nodes / 20, 12);
 }
 
-void HighsPrimalHeuristics::RENS(const std::vector<double>& tmp) {
+void HighsPrimalHeuristics::RENS(const std::vector<double>& tmp,
+                                 double maxFixingRate) {
   HighsPseudocost pscost(mipsolver.mipdata_->pseudocost);
   HighsSearch heur(mipsolver, pscost);
   HighsDomain& localdom = heur.getLocalDomain();
@@ -321,7 +446,7 @@ void HighsPrimalHeuristics::RENS(const std::vector<double>& tmp) {
 
   // determine the initial number of unfixed variables fixing rate to decide if
   // the problem is restricted enough to be considered for solving a submip
-  double maxfixingrate = determineTargetFixingRate();
+  double maxfixingrate = std::min(determineTargetFixingRate(), maxFixingRate);
   double fixingrate = 0.0;
   bool stop = false;
   // heurlp.setIterationLimit(2 * mipsolver.mipdata_->maxrootlpiters);
@@ -510,11 +635,13 @@ retry:
   }
 
   heurlp.removeObsoleteRows(false);
-  if (!solveSubMip(heurlp.getLp(), heurlp.getLpSolver().getBasis(), fixingrate,
-                   localdom.col_lower_, localdom.col_upper_,
-                   500,  // std::max(50, int(0.05 *
-                         // (mipsolver.mipdata_->num_leaves))),
-                   200 + mipsolver.mipdata_->num_nodes / 20, 12)) {
+  SubMipResult submipresult = solveSubMip(
+      heurlp.getLp(), heurlp.getLpSolver().getBasis(), fixingrate,
+      localdom.col_lower_, localdom.col_upper_,
+      500,  // std::max(50, int(0.05 *
+            // (mipsolver.mipdata_->num_leaves))),
+      200 + mipsolver.mipdata_->num_nodes / 20, 12);
+  if (submipresult != SubMipResult::kSolved) {
     int64_t new_lp_iterations = lp_iterations + heur.getLocalLpIterations();
     if (new_lp_iterations + mipsolver.mipdata_->heuristic_lp_iterations >
         100000 + ((mipsolver.mipdata_->total_lp_iterations -
@@ -531,6 +658,15 @@ retry:
       return;
     }
     maxfixingrate = fixingrate * 0.5;
+    if (submipresult == SubMipResult::kDeferred) {
+      // the sub-MIP runs in the background, so RENS is only repeated when
+      // the sub-MIP turns out to be infeasible in its root node
+      backgroundSubMip->retry = [this, tmp, maxfixingrate]() {
+        RENS(tmp, maxfixingrate);
+      };
+      lp_iterations = new_lp_iterations;
+      return;
+    }
     // printf("infeasible in root node, trying with lower fixing rate %g\n",
     //        maxfixingrate);
     goto retry;
@@ -539,7 +675,8 @@ retry:
   lp_iterations += heur.getLocalLpIterations();
 }
 
-void HighsPrimalHeuristics::RINS(const std::vector<double>& relaxationsol) {
+void HighsPrimalHeuristics::RINS(const std::vector<double>& relaxationsol,
+                                 double maxFixingRate) {
   if (int(relaxationsol.size()) != mipsolver.numCol()) return;
 
   intcols.erase(std::remove_if(intcols.begin(), intcols.end(),
@@ -567,7 +704,7 @@ void HighsPrimalHeuristics::RINS(const std::vector<double>& relaxationsol) {
 
   // determine the initial number of unfixed variables fixing rate to decide if
   // the problem is restricted enough to be considered for solving a submip
-  double maxfixingrate = determineTargetFixingRate();
+  double maxfixingrate = std::min(determineTargetFixingRate(), maxFixingRate);
   double minfixingrate = 0.25;
   double fixingrate = 0.0;
   bool stop = false;
@@ -797,11 +934,13 @@ retry:
   }
 
   heurlp.removeObsoleteRows(false);
-  if (!solveSubMip(heurlp.getLp(), heurlp.getLpSolver().getBasis(), fixingrate,
-                   localdom.col_lower_, localdom.col_upper_,
-                   500,  // std::max(50, int(0.05 *
-                         // (mipsolver.mipdata_->num_leaves))),
-                   200 + mipsolver.mipdata_->num_nodes / 20, 12)) {
+  SubMipResult submipresult = solveSubMip(
+      heurlp.getLp(), heurlp.getLpSolver().getBasis(), fixingrate,
+      localdom.col_lower_, localdom.col_upper_,
+      500,  // std::max(50, int(0.05 *
+            // (mipsolver.mipdata_->num_leaves))),
+      200 + mipsolver.mipdata_->num_nodes / 20, 12);
+  if (submipresult != SubMipResult::kSolved) {
     int64_t new_lp_iterations = lp_iterations + heur.getLocalLpIterations();
     if (new_lp_iterations + mipsolver.mipdata_->heuristic_lp_iterations >
         100000 + ((mipsolver.mipdata_->total_lp_iterations -
@@ -819,12 +958,256 @@ retry:
     }
     // printf("infeasible in root node, trying with lower fixing rate\n");
     maxfixingrate = fixingrate * 0.5;
+    if (submipresult == SubMipResult::kDeferred) {
+      // the sub-MIP runs in the background, so RINS is only repeated when
+      // the sub-MIP turns out to be infeasible in its root node
+      backgroundSubMip->retry = [this, relaxationsol, maxfixingrate]() {
+        RINS(relaxationsol, maxfixingrate);
+      };
+      lp_iterations = new_lp_iterations;
+      return;
+    }
     goto retry;
   }
 
   lp_iterations += heur.getLocalLpIterations();
 }
 
+void HighsPrimalHeuristics::addPoolSolution(
+    const std::vector<double>& solution) {
+  if (solutionPool.size() == kAlnsPoolSize)
+    solutionPool.erase(solutionPool.begin());
+  solutionPool.push_back(solution);
+}
+
+HighsInt HighsPrimalHeuristics::selectAlnsNeighbourhood(
+    const std::array<bool, kNumAlnsNeighbourhoods>& excluded) const {
+  HighsInt best = -1;
+  double bestScore = -kHighsInf;
+  for (HighsInt i = 0; i != kNumAlnsNeighbourhoods; ++i) {
+    if (excluded[i]) continue;
+    // neighbourhoods that were never solved are tried first
+    if (alnsStats[i].numCalls == 0) return i;
+
+    double score = alnsStats[i].meanReward +
+                   kAlnsExploration *
+                       std::sqrt(2.0 * std::log(double(numAlnsCalls)) /
+                                 alnsStats[i].numCalls);
+    if (score > bestScore) {
+      best = i;
+      bestScore = score;
+    }
+  }
+
+  return best;
+}
+
+bool HighsPrimalHeuristics::alnsNeighbourhood(
+    HighsInt neighbourhood, const std::vector<double>& relaxationsol) {
+  if (neighbourhood == kAlnsRins) {
+    RINS(relaxationsol);
+    return true;
+  }
+
+  HighsMipSolverData& mipdata = *mipsolver.mipdata_;
+  const std::vector<double>& incumbent = mipdata.incumbent;
+  const double feastol = mipdata.feastol;
+
+  std::vector<double> colLower = mipdata.domain.col_lower_;
+  std::vector<double> colUpper = mipdata.domain.col_upper_;
+  HighsLp lp = mipdata.lp.getLp();
+  HighsBasis basis = mipdata.lp.getLpSolver().getBasis();
+  bool objectiveCutoff = true;
+
+  // fixes an integer column to its value in the incumbent, which may lie
+  // outside of the global domain after reduced cost fixing
+  HighsInt numFixed = 0;
+  auto fixCol = [&](HighsInt col) {
+    double val = HighsIntegers::nearestInteger(incumbent[col]);
+    val = std::max(colLower[col], std::min(colUpper[col], val));
+    colLower[col] = val;
+    colUpper[col] = val;
+    ++numFixed;
+  };
+
+  auto addRow = [&](const std::vector<HighsInt>& inds,
+                    const std::vector<double>& vals, double upper) {
+    HighsSparseMatrix row;
+    row.format_ = MatrixFormat::kRowwise;
+    row.num_col_ = lp.num_col_;
+    row.num_row_ = 1;
+    row.start_ = {0, (HighsInt)inds.size()};
+    row.index_ = inds;
+    row.value_ = vals;
+    lp.a_matrix_.addRows(row);
+    lp.row_lower_.push_back(-kHighsInf);
+    lp.row_upper_.push_back(upper);
+    ++lp.num_row_;
+    if (!lp.row_names_.empty()) lp.row_names_.resize(lp.num_row_);
+    basis.row_status.push_back(HighsBasisStatus::kBasic);
+  };
+
+  std::vector<HighsInt> unfixedCols;
+  for (HighsInt col : mipdata.integer_cols)
+    if (colLower[col] != colUpper[col]) unfixedCols.push_back(col);
+  if (unfixedCols.empty()) return false;
+
+  // the row of the objective function
+  std::vector<HighsInt> objInds;
+  std::vector<double> objVals;
+  for (HighsInt col = 0; col != lp.num_col_; ++col) {
+    if (lp.col_cost_[col] == 0.0) continue;
+    objInds.push_back(col);
+    objVals.push_back(lp.col_cost_[col]);
+  }
+
+  // the distance of the binary columns to the incumbent as a row, whose
+  // constant part is the number of binary columns at one in the incumbent
+  std::vector<HighsInt> distInds;
+  std::vector<double> distVals;
+  HighsInt numOnes = 0;
+  for (HighsInt col : unfixedCols) {
+    if (colLower[col] != 0.0 || colUpper[col] != 1.0) continue;
+    distInds.push_back(col);
+    if (incumbent[col] > 0.5) {
+      distVals.push_back(-1.0);
+      ++numOnes;
+    } else
+      distVals.push_back(1.0);
+  }
+
+  switch (neighbourhood) {
+    case kAlnsMutation: {
+      // fix a random subset of the integer columns
+      double fixingRate = determineTargetFixingRate();
+      for (HighsInt col : unfixedCols)
+        if (randgen.fraction() < fixingRate) fixCol(col);
+      break;
+    }
+    case kAlnsCrossover: {
+      // fix the columns on which the incumbent agrees with an earlier
+      // incumbent
+      if (solutionPool.size() < 2) return false;
+      const std::vector<double>& other =
+          solutionPool[randgen.integer(solutionPool.size() - 1)];
+      if (other.size() != incumbent.size()) return false;
+      for (HighsInt col : unfixedCols)
+        if (std::abs(incumbent[col] - other[col]) <= feastol) fixCol(col);
+      break;
+    }
+    case kAlnsDins: {
+      // fix the columns on which the incumbent agrees with the node and the
+      // root LP solution, and restrict the others to the distance between
+      // the incumbent and the node LP solution
+      for (HighsInt col : unfixedCols) {
+        double dist = std::abs(incumbent[col] - relaxationsol[col]);
+        if (dist < 0.5 && (mipdata.rootlpsol.empty() ||
+                           std::abs(incumbent[col] - mipdata.rootlpsol[col]) <
+                               0.5)) {
+          fixCol(col);
+          continue;
+        }
+        colLower[col] = std::max(
+            colLower[col], std::ceil(relaxationsol[col] - dist - feastol));
+        colUpper[col] = std::min(
+            colUpper[col], std::floor(relaxationsol[col] + dist + feastol));
+        if (colLower[col] > colUpper[col]) return false;
+      }
+      break;
+    }
+    case kAlnsLocalBranching: {
+      // allow at most a given number of binary columns to flip
+      if ((HighsInt)distInds.size() <= 2 * kAlnsLocalBranchingSize)
+        return false;
+      addRow(distInds, distVals, double(kAlnsLocalBranchingSize - numOnes));
+      break;
+    }
+    case kAlnsProximity: {
+      // minimize the distance to the incumbent subject to an improvement of
+      // the objective
+      if (distInds.empty() || objInds.empty()) return false;
+      double cutoff = mipdata.upper_limit;
+      if (mipdata.lower_bound > -kHighsInf)
+        cutoff -= 0.1 * (mipdata.upper_limit - mipdata.lower_bound);
+      addRow(objInds, objVals, cutoff);
+      lp.col_cost_.assign(lp.num_col_, 0.0);
+      for (size_t i = 0; i != distInds.size(); ++i)
+        lp.col_cost_[distInds[i]] = distVals[i];
+      objectiveCutoff = false;
+      break;
+    }
+    case kAlnsObjectiveConstrained: {
+      // fix the columns on which the incumbent agrees with the node LP
+      // solution and require to close half of the gap
+      if (mipdata.lower_bound == -kHighsInf || objInds.empty()) return false;
+      for (HighsInt col : unfixedCols)
+        if (std::abs(incumbent[col] - relaxationsol[col]) <= feastol)
+          fixCol(col);
+      addRow(objInds, objVals,
+             mipdata.upper_limit -
+                 0.5 * (mipdata.upper_limit - mipdata.lower_bound));
+      break;
+    }
+  }
+
+  double fixingRate = double(numFixed) / double(unfixedCols.size());
+  if (neighbourhood != kAlnsLocalBranching &&
+      neighbourhood != kAlnsProximity && fixingRate < kAlnsMinFixingRate)
+    return false;
+
+  solveSubMip(lp, basis, fixingRate, std::move(colLower), std::move(colUpper),
+              500, 200 + mipdata.num_nodes / 20, 12, objectiveCutoff);
+  return true;
+}
+
+void HighsPrimalHeuristics::ALNS(const std::vector<double>& relaxationsol) {
+  if (mipsolver.mipdata_->incumbent.empty() ||
+      int(relaxationsol.size()) != mipsolver.numCol())
+    return;
+
+  // the reward of a neighbourhood is only known when its sub-MIP is solved
+  // right away
+  bool inBackground = subMipsInBackground;
+  subMipsInBackground = false;
+
+  std::array<bool, kNumAlnsNeighbourhoods> excluded;
+  excluded.fill(false);
+  while (true) {
+    HighsInt neighbourhood = selectAlnsNeighbourhood(excluded);
+    if (neighbourhood == -1) break;
+
+    double oldUpperBound = mipsolver.mipdata_->upper_bound;
+    double oldGap = oldUpperBound - mipsolver.mipdata_->lower_bound;
+    size_t oldLpIterations = lp_iterations;
+    if (!alnsNeighbourhood(neighbourhood, relaxationsol)) {
+      // the neighbourhood does not apply to the current incumbent
+      excluded[neighbourhood] = true;
+      continue;
+    }
+
+    double gain = 0.0;
+    if (mipsolver.mipdata_->upper_bound < oldUpperBound)
+      gain = oldGap == kHighsInf
+                 ? 1.0
+                 : std::min(1.0, (oldUpperBound -
+                                  mipsolver.mipdata_->upper_bound) /
+                                     std::max(oldGap,
+                                              mipsolver.mipdata_->feastol));
+    double effort = std::max(
+        1.0, double(lp_iterations - oldLpIterations) / kAlnsEffortUnit);
+
+    AlnsStatistics& stats = alnsStats[neighbourhood];
+    ++stats.numCalls;
+    ++numAlnsCalls;
+    if (gain > 0.0) ++numAlnsSuccesses;
+    stats.meanReward += (gain / effort - stats.meanReward) /
+                        std::min(stats.numCalls, kAlnsRewardWindow);
+    break;
+  }
+
+  subMipsInBackground = inBackground;
+}
+
 bool HighsPrimalHeuristics::tryRoundedPoint(const std::vector<double>& point,
                                             char source) {
   auto localdom = mipsolver.mipdata_->domain;
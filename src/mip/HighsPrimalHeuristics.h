@@ -11,6 +11,9 @@
 #ifndef HIGHS_PRIMAL_HEURISTICS_H_
 #define HIGHS_PRIMAL_HEURISTICS_H_
 
+#include <array>
+#include <functional>
+#include <memory>
 #include <vector>
 
 #include "lp_data/HStruct.h"
@@ -21,6 +24,8 @@ class HighsMipSolver;
 
 class HighsPrimalHeuristics {
  private:
+  struct BackgroundSubMip;
+
   HighsMipSolver& mipsolver;
   size_t lp_iterations;
 
@@ -33,23 +38,90 @@ class HighsPrimalHeuristics {
 
   std::vector<HighsInt> intcols;
 
+  bool subMipsInBackground;
+  std::unique_ptr<BackgroundSubMip> backgroundSubMip;
+
+  // neighbourhoods of the adaptive large neighbourhood search (ALNS)
+  enum AlnsNeighbourhood {
+    kAlnsRins = 0,
+    kAlnsMutation,
+    kAlnsCrossover,
+    kAlnsDins,
+    kAlnsLocalBranching,
+    kAlnsProximity,
+    kAlnsObjectiveConstrained,
+    kNumAlnsNeighbourhoods,
+  };
+
+  // the reward of a neighbourhood is the fraction of the gap that it closed
+  // per unit of effort, averaged over its recent calls
+  struct AlnsStatistics {
+    double meanReward = 0.0;
+    HighsInt numCalls = 0;
+  };
+  std::array<AlnsStatistics, kNumAlnsNeighbourhoods> alnsStats;
+  HighsInt numAlnsCalls;
+  // calls of the ALNS whose sub-MIP improved the incumbent
+  HighsInt numAlnsSuccesses;
+
+  // the most recent incumbents of the current run, the last one is the best
+  std::vector<std::vector<double>> solutionPool;
+
+  bool processSubMipResult(const HighsMipSolver& submipsolver,
+                           double fixingRate, double numUnfixed);
+
+  HighsInt selectAlnsNeighbourhood(
+      const std::array<bool, kNumAlnsNeighbourhoods>& excluded) const;
+
+  bool alnsNeighbourhood(HighsInt neighbourhood,
+                         const std::vector<double>& relaxationsol);
+
  public:
   HighsPrimalHeuristics(HighsMipSolver& mipsolver);
 
+  ~HighsPrimalHeuristics();
+
   void setupIntCols();
 
-  bool solveSubMip(const HighsLp& lp, const HighsBasis& basis,
-                   double fixingRate, std::vector<double> colLower,
-                   std::vector<double> colUpper, HighsInt maxleaves,
-                   HighsInt maxnodes, HighsInt stallnodes);
+  // when set, the next sub-MIP of RENS/RINS is solved on a separate task and
+  // its result is only used in finishBackgroundSubMip()
+  void setSubMipsInBackground(bool inBackground) {
+    subMipsInBackground = inBackground;
+  }
+
+  void finishBackgroundSubMip();
+
+  // a sub-MIP is infeasible when it was found infeasible in its root node, and
+  // deferred when it is solved in the background
+  enum class SubMipResult { kInfeasible, kSolved, kDeferred };
+
+  SubMipResult solveSubMip(const HighsLp& lp, const HighsBasis& basis,
+                           double fixingRate, std::vector<double> colLower,
+                           std::vector<double> colUpper, HighsInt maxleaves,
+                           HighsInt maxnodes, HighsInt stallnodes,
+                           bool objectiveCutoff = true);
 
   double determineTargetFixingRate();
 
   void rootReducedCost();
 
-  void RENS(const std::vector<double>& relaxationsol);
+  // the fixing rate of the sub-MIP is at most maxFixingRate
+  void RENS(const std::vector<double>& relaxationsol,
+            double maxFixingRate = 1.0);
+
+  void RINS(const std::vector<double>& relaxationsol,
+            double maxFixingRate = 1.0);
+
+  // stores a new incumbent for the crossover of solutions
+  void addPoolSolution(const std::vector<double>& solution);
+
+  // solves the sub-MIP of a neighbourhood of the incumbent that a bandit
+  // learner selects by the improvement it observed per unit of effort
+  void ALNS(const std::vector<double>& relaxationsol);
+
+  HighsInt getNumAlnsCalls() const { return numAlnsCalls; }
 
-  void RINS(const std::vector<double>& relaxationsol);
+  HighsInt getNumAlnsSuccesses() const { return numAlnsSuccesses; }
 
   void feasibilityPump();
 
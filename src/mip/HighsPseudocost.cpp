@@ -13,18 +13,7 @@
 #include "mip/HighsMipSolverData.h"
 
 HighsPseudocost::HighsPseudocost(const HighsMipSolver& mipsolver)
-    : pseudocostup(mipsolver.numCol()),
-      pseudocostdown(mipsolver.numCol()),
-      nsamplesup(mipsolver.numCol()),
-      nsamplesdown(mipsolver.numCol()),
-      inferencesup(mipsolver.numCol()),
-      inferencesdown(mipsolver.numCol()),
-      ninferencesup(mipsolver.numCol()),
-      ninferencesdown(mipsolver.numCol()),
-      ncutoffsup(mipsolver.numCol()),
-      ncutoffsdown(mipsolver.numCol()),
-      conflictscoreup(mipsolver.numCol()),
-      conflictscoredown(mipsolver.numCol()),
+    : colstats(mipsolver.numCol(), ColStats()),
       conflict_weight(1.0),
       conflict_avg_score(0.0),
       cost_total(0),
@@ -46,32 +35,35 @@ HighsPseudocost::HighsPseudocost(const HighsMipSolver& mipsolver)
     for (HighsInt i = 0; i != mipsolver.numCol(); ++i) {
       HighsInt origCol = mipsolver.mipdata_->postSolveStack.getOrigColIndex(i);
 
-      pseudocostup[i] = mipsolver.pscostinit->pseudocostup[origCol];
-      nsamplesup[i] = mipsolver.pscostinit->nsamplesup[origCol];
-      pseudocostdown[i] = mipsolver.pscostinit->pseudocostdown[origCol];
-      nsamplesdown[i] = mipsolver.pscostinit->nsamplesdown[origCol];
-      inferencesup[i] = mipsolver.pscostinit->inferencesup[origCol];
-      ninferencesup[i] = mipsolver.pscostinit->ninferencesup[origCol];
-      inferencesdown[i] = mipsolver.pscostinit->inferencesdown[origCol];
-      ninferencesdown[i] = mipsolver.pscostinit->ninferencesdown[origCol];
-      conflictscoreup[i] = mipsolver.pscostinit->conflictscoreup[origCol];
-      conflictscoredown[i] = mipsolver.pscostinit->conflictscoredown[origCol];
+      ColStats& stats = colstats[i];
+
+      stats.pseudocostup = mipsolver.pscostinit->pseudocostup[origCol];
+      stats.nsamplesup = mipsolver.pscostinit->nsamplesup[origCol];
+      stats.pseudocostdown = mipsolver.pscostinit->pseudocostdown[origCol];
+      stats.nsamplesdown = mipsolver.pscostinit->nsamplesdown[origCol];
+      stats.inferencesup = mipsolver.pscostinit->inferencesup[origCol];
+      stats.ninferencesup = mipsolver.pscostinit->ninferencesup[origCol];
+      stats.inferencesdown = mipsolver.pscostinit->inferencesdown[origCol];
+      stats.ninferencesdown = mipsolver.pscostinit->ninferencesdown[origCol];
+      stats.conflictscoreup = mipsolver.pscostinit->conflictscoreup[origCol];
+      stats.conflictscoredown =
+          mipsolver.pscostinit->conflictscoredown[origCol];
     }
   }
 }
 
 HighsPseudocostInitialization::HighsPseudocostInitialization(
     const HighsPseudocost& pscost, HighsInt maxCount)
-    : pseudocostup(pscost.pseudocostup),
-      pseudocostdown(pscost.pseudocostdown),
-      nsamplesup(pscost.nsamplesup),
-      nsamplesdown(pscost.nsamplesdown),
-      inferencesup(pscost.inferencesup),
-      inferencesdown(pscost.inferencesdown),
-      ninferencesup(pscost.ninferencesup),
-      ninferencesdown(pscost.ninferencesdown),
-      conflictscoreup(pscost.conflictscoreup.size()),
-      conflictscoredown(pscost.conflictscoreup.size()),
+    : pseudocostup(pscost.colstats.size()),
+      pseudocostdown(pscost.colstats.size()),
+      nsamplesup(pscost.colstats.size()),
+      nsamplesdown(pscost.colstats.size()),
+      inferencesup(pscost.colstats.size()),
+      inferencesdown(pscost.colstats.size()),
+      ninferencesup(pscost.colstats.size()),
+      ninferencesdown(pscost.colstats.size()),
+      conflictscoreup(pscost.colstats.size()),
+      conflictscoredown(pscost.colstats.size()),
       cost_total(pscost.cost_total),
       inferences_total(pscost.inferences_total),
       conflict_avg_score(pscost.conflict_avg_score),
@@ -80,12 +72,17 @@ HighsPseudocostInitialization::HighsPseudocostInitialization(
   HighsInt ncol = pseudocostup.size();
   conflict_avg_score /= ncol * pscost.conflict_weight;
   for (HighsInt i = 0; i != ncol; ++i) {
-    nsamplesup[i] = std::min(nsamplesup[i], maxCount);
-    nsamplesdown[i] = std::min(nsamplesdown[i], maxCount);
-    ninferencesup[i] = std::min(ninferencesup[i], HighsInt{1});
-    ninferencesdown[i] = std::min(ninferencesdown[i], HighsInt{1});
-    conflictscoreup[i] = pscost.conflictscoreup[i] / pscost.conflict_weight;
-    conflictscoredown[i] = pscost.conflictscoredown[i] / pscost.conflict_weight;
+    const HighsPseudocost::ColStats& stats = pscost.colstats[i];
+    pseudocostup[i] = stats.pseudocostup;
+    pseudocostdown[i] = stats.pseudocostdown;
+    nsamplesup[i] = std::min(stats.nsamplesup, maxCount);
+    nsamplesdown[i] = std::min(stats.nsamplesdown, maxCount);
+    inferencesup[i] = stats.inferencesup;
+    inferencesdown[i] = stats.inferencesdown;
+    ninferencesup[i] = std::min(stats.ninferencesup, HighsInt{1});
+    ninferencesdown[i] = std::min(stats.ninferencesdown, HighsInt{1});
+    conflictscoreup[i] = stats.conflictscoreup / pscost.conflict_weight;
+    conflictscoredown[i] = stats.conflictscoredown / pscost.conflict_weight;
   }
 }
 
@@ -108,25 +105,22 @@ HighsPseudocostInitialization::HighsPseudocostInitialization(
   conflictscoreup.resize(postsolveStack.getOrigNumCol());
   conflictscoredown.resize(postsolveStack.getOrigNumCol());
 
-  HighsInt ncols = pscost.pseudocostup.size();
+  HighsInt ncols = pscost.colstats.size();
   conflict_avg_score /= ncols * pscost.conflict_weight;
 
   for (HighsInt i = 0; i != ncols; ++i) {
-    pseudocostup[postsolveStack.getOrigColIndex(i)] = pscost.pseudocostup[i];
-    pseudocostdown[postsolveStack.getOrigColIndex(i)] =
-        pscost.pseudocostdown[i];
-    nsamplesup[postsolveStack.getOrigColIndex(i)] =
-        std::min(maxCount, pscost.nsamplesup[i]);
-    nsamplesdown[postsolveStack.getOrigColIndex(i)] =
-        std::min(maxCount, pscost.nsamplesdown[i]);
-    inferencesup[postsolveStack.getOrigColIndex(i)] = pscost.inferencesup[i];
-    inferencesdown[postsolveStack.getOrigColIndex(i)] =
-        pscost.inferencesdown[i];
-    ninferencesup[postsolveStack.getOrigColIndex(i)] = 1;
-    ninferencesdown[postsolveStack.getOrigColIndex(i)] = 1;
-    conflictscoreup[postsolveStack.getOrigColIndex(i)] =
-        pscost.conflictscoreup[i] / pscost.conflict_weight;
-    conflictscoredown[postsolveStack.getOrigColIndex(i)] =
-        pscost.conflictscoredown[i] / pscost.conflict_weight;
+    const HighsPseudocost::ColStats& stats = pscost.colstats[i];
+    HighsInt origCol = postsolveStack.getOrigColIndex(i);
+    pseudocostup[origCol] = stats.pseudocostup;
+    pseudocostdown[origCol] = stats.pseudocostdown;
+    nsamplesup[origCol] = std::min(maxCount, stats.nsamplesup);
+    nsamplesdown[origCol] = std::min(maxCount, stats.nsamplesdown);
+    inferencesup[origCol] = stats.inferencesup;
+    inferencesdown[origCol] = stats.inferencesdown;
+    ninferencesup[origCol] = 1;
+    ninferencesdown[origCol] = 1;
+    conflictscoreup[origCol] = stats.conflictscoreup / pscost.conflict_weight;
+    conflictscoredown[origCol] =
+        stats.conflictscoredown / pscost.conflict_weight;
   }
 }
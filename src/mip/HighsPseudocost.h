@@ -44,6 +44,7 @@ struct HighsPseudocostInitialization {
   int64_t nsamplestotal;
   int64_t ninferencestotal;
 
+  HighsPseudocostInitialization() = default;
   HighsPseudocostInitialization(const HighsPseudocost& pscost,
                                 HighsInt maxCount);
   HighsPseudocostInitialization(
@@ -52,18 +53,33 @@ struct HighsPseudocostInitialization {
 };
 class HighsPseudocost {
   friend struct HighsPseudocostInitialization;
-  std::vector<double> pseudocostup;
-  std::vector<double> pseudocostdown;
-  std::vector<HighsInt> nsamplesup;
-  std::vector<HighsInt> nsamplesdown;
-  std::vector<double> inferencesup;
-  std::vector<double> inferencesdown;
-  std::vector<HighsInt> ninferencesup;
-  std::vector<HighsInt> ninferencesdown;
-  std::vector<HighsInt> ncutoffsup;
-  std::vector<HighsInt> ncutoffsdown;
-  std::vector<double> conflictscoreup;
-  std::vector<double> conflictscoredown;
+  // statistics of one column, kept in a single record so that scoring a
+  // candidate reads one contiguous block instead of gathering from a separate
+  // array per statistic
+  struct ColStats {
+    double pseudocostup;
+    double pseudocostdown;
+    double inferencesup;
+    double inferencesdown;
+    double conflictscoreup;
+    double conflictscoredown;
+    HighsInt nsamplesup;
+    HighsInt nsamplesdown;
+    HighsInt ninferencesup;
+    HighsInt ninferencesdown;
+    HighsInt ncutoffsup;
+    HighsInt ncutoffsdown;
+  };
+
+  // denominators of the score terms that are the same for all columns
+  struct ScoreNormalization {
+    double costNorm;
+    double inferenceNorm;
+    double cutoffNorm;
+    double conflictNorm;
+  };
+
+  std::vector<ColStats> colstats;
 
   double conflict_weight;
   double conflict_avg_score;
@@ -75,18 +91,74 @@ class HighsPseudocost {
   HighsInt minreliable;
   double degeneracyFactor;
 
+  double getAvgCutoffs() const {
+    return static_cast<double>(ncutoffstotal) /
+           std::max(1.0, static_cast<double>(ncutoffstotal) +
+                             static_cast<double>(nsamplestotal));
+  }
+
+  double getAvgConflictScore() const {
+    return conflict_avg_score /
+           (conflict_weight * static_cast<double>(colstats.size()));
+  }
+
+  ScoreNormalization getScoreNormalization() const {
+    double avgCutoffs = getAvgCutoffs();
+    double conflictScoreAvg = getAvgConflictScore();
+
+    ScoreNormalization norm;
+    norm.costNorm = std::max(1e-6, cost_total * cost_total);
+    norm.inferenceNorm = std::max(1e-6, inferences_total * inferences_total);
+    norm.cutoffNorm = std::max(1e-6, avgCutoffs * avgCutoffs);
+    norm.conflictNorm = std::max(1e-6, conflictScoreAvg * conflictScoreAvg);
+    return norm;
+  }
+
+  double getScore(const ColStats& stats, const ScoreNormalization& norm,
+                  double upcost, double downcost) const {
+    double costScore =
+        std::max(upcost, 1e-6) * std::max(downcost, 1e-6) / norm.costNorm;
+    double inferenceScore = std::max(stats.inferencesup, 1e-6) *
+                            std::max(stats.inferencesdown, 1e-6) /
+                            norm.inferenceNorm;
+
+    double cutOffScoreUp =
+        stats.ncutoffsup /
+        std::max(1.0, static_cast<double>(stats.ncutoffsup) +
+                          static_cast<double>(stats.nsamplesup));
+    double cutOffScoreDown =
+        stats.ncutoffsdown /
+        std::max(1.0, static_cast<double>(stats.ncutoffsdown) +
+                          static_cast<double>(stats.nsamplesdown));
+
+    double cutoffScore = std::max(cutOffScoreUp, 1e-6) *
+                         std::max(cutOffScoreDown, 1e-6) / norm.cutoffNorm;
+
+    double conflictScoreUp = stats.conflictscoreup / conflict_weight;
+    double conflictScoreDown = stats.conflictscoredown / conflict_weight;
+    double conflictScore = std::max(conflictScoreUp, 1e-6) *
+                           std::max(conflictScoreDown, 1e-6) /
+                           norm.conflictNorm;
+
+    auto mapScore = [](double score) { return 1.0 - 1.0 / (1.0 + score); };
+    return mapScore(costScore) / degeneracyFactor +
+           degeneracyFactor *
+               (1e-2 * mapScore(conflictScore) +
+                1e-4 * (mapScore(cutoffScore) + mapScore(inferenceScore)));
+  }
+
  public:
   HighsPseudocost() = default;
   HighsPseudocost(const HighsMipSolver& mipsolver);
 
   void subtractBase(const HighsPseudocost& base) {
-    HighsInt ncols = pseudocostup.size();
+    HighsInt ncols = colstats.size();
 
     for (HighsInt i = 0; i != ncols; ++i) {
-      pseudocostup[i] -= base.pseudocostup[i];
-      pseudocostdown[i] -= base.pseudocostdown[i];
-      nsamplesup[i] -= base.nsamplesup[i];
-      nsamplesdown[i] -= base.nsamplesdown[i];
+      colstats[i].pseudocostup -= base.colstats[i].pseudocostup;
+      colstats[i].pseudocostdown -= base.colstats[i].pseudocostdown;
+      colstats[i].nsamplesup -= base.colstats[i].nsamplesup;
+      colstats[i].nsamplesdown -= base.colstats[i].nsamplesdown;
     }
   }
 
@@ -98,10 +170,9 @@ class HighsPseudocost {
       conflict_weight = 1.0;
       conflict_avg_score *= scale;
 
-      HighsInt numCol = conflictscoreup.size();
-      for (HighsInt i = 0; i < numCol; ++i) {
-        conflictscoreup[i] *= scale;
-        conflictscoredown[i] *= scale;
+      for (ColStats& stats : colstats) {
+        stats.conflictscoreup *= scale;
+        stats.conflictscoredown *= scale;
       }
     }
   }
@@ -112,12 +183,12 @@ class HighsPseudocost {
   }
 
   void increaseConflictScoreUp(HighsInt col) {
-    conflictscoreup[col] += conflict_weight;
+    colstats[col].conflictscoreup += conflict_weight;
     conflict_avg_score += conflict_weight;
   }
 
   void increaseConflictScoreDown(HighsInt col) {
-    conflictscoredown[col] += conflict_weight;
+    colstats[col].conflictscoredown += conflict_weight;
     conflict_avg_score += conflict_weight;
   }
 
@@ -126,40 +197,43 @@ class HighsPseudocost {
   HighsInt getMinReliable() const { return minreliable; }
 
   HighsInt getNumObservations(HighsInt col) const {
-    return nsamplesup[col] + nsamplesdown[col];
+    return colstats[col].nsamplesup + colstats[col].nsamplesdown;
   }
 
-  HighsInt getNumObservationsUp(HighsInt col) const { return nsamplesup[col]; }
+  HighsInt getNumObservationsUp(HighsInt col) const {
+    return colstats[col].nsamplesup;
+  }
 
   HighsInt getNumObservationsDown(HighsInt col) const {
-    return nsamplesdown[col];
+    return colstats[col].nsamplesdown;
   }
 
   void addCutoffObservation(HighsInt col, bool upbranch) {
     ++ncutoffstotal;
     if (upbranch)
-      ncutoffsup[col] += 1;
+      colstats[col].ncutoffsup += 1;
     else
-      ncutoffsdown[col] += 1;
+      colstats[col].ncutoffsdown += 1;
   }
 
   void addObservation(HighsInt col, double delta, double objdelta) {
     assert(delta != 0.0);
     assert(objdelta >= 0.0);
+    ColStats& stats = colstats[col];
     if (delta > 0.0) {
       double unit_gain = objdelta / delta;
-      double d = unit_gain - pseudocostup[col];
-      nsamplesup[col] += 1;
-      pseudocostup[col] += d / nsamplesup[col];
+      double d = unit_gain - stats.pseudocostup;
+      stats.nsamplesup += 1;
+      stats.pseudocostup += d / stats.nsamplesup;
 
       d = unit_gain - cost_total;
       ++nsamplestotal;
       cost_total += d / static_cast<double>(nsamplestotal);
     } else {
       double unit_gain = -objdelta / delta;
-      double d = unit_gain - pseudocostdown[col];
-      nsamplesdown[col] += 1;
-      pseudocostdown[col] += d / nsamplesdown[col];
+      double d = unit_gain - stats.pseudocostdown;
+      stats.nsamplesdown += 1;
+      stats.pseudocostdown += d / stats.nsamplesdown;
 
       d = unit_gain - cost_total;
       ++nsamplestotal;
@@ -172,121 +246,90 @@ class HighsPseudocost {
     double d = ninferences - inferences_total;
     ++ninferencestotal;
     inferences_total += d / static_cast<double>(ninferencestotal);
+    ColStats& stats = colstats[col];
     if (upbranch) {
-      d = ninferences - inferencesup[col];
-      ninferencesup[col] += 1;
-      inferencesup[col] += d / ninferencesup[col];
+      d = ninferences - stats.inferencesup;
+      stats.ninferencesup += 1;
+      stats.inferencesup += d / stats.ninferencesup;
     } else {
-      d = ninferences - inferencesdown[col];
-      ninferencesdown[col] += 1;
-      inferencesdown[col] += d / ninferencesdown[col];
+      d = ninferences - stats.inferencesdown;
+      stats.ninferencesdown += 1;
+      stats.inferencesdown += d / stats.ninferencesdown;
     }
   }
 
   bool isReliable(HighsInt col) const {
-    return std::min(nsamplesup[col], nsamplesdown[col]) >= minreliable;
+    return std::min(colstats[col].nsamplesup, colstats[col].nsamplesdown) >=
+           minreliable;
   }
 
   bool isReliableUp(HighsInt col) const {
-    return nsamplesup[col] >= minreliable;
+    return colstats[col].nsamplesup >= minreliable;
   }
 
   bool isReliableDown(HighsInt col) const {
-    return nsamplesdown[col] >= minreliable;
+    return colstats[col].nsamplesdown >= minreliable;
   }
 
   double getAvgPseudocost() const { return cost_total; }
 
   double getPseudocostUp(HighsInt col, double frac, double offset) const {
+    const ColStats& stats = colstats[col];
     double up = std::ceil(frac) - frac;
     double cost;
 
-    if (nsamplesup[col] == 0 || nsamplesup[col] < minreliable) {
+    if (stats.nsamplesup == 0 || stats.nsamplesup < minreliable) {
       double weightPs =
-          nsamplesup[col] == 0
+          stats.nsamplesup == 0
               ? 0
-              : 0.9 + 0.1 * nsamplesup[col] / static_cast<double>(minreliable);
-      cost = weightPs * pseudocostup[col];
+              : 0.9 + 0.1 * stats.nsamplesup / static_cast<double>(minreliable);
+      cost = weightPs * stats.pseudocostup;
       cost += (1.0 - weightPs) * getAvgPseudocost();
     } else
-      cost = pseudocostup[col];
+      cost = stats.pseudocostup;
     return up * (offset + cost);
   }
 
   double getPseudocostDown(HighsInt col, double frac, double offset) const {
+    const ColStats& stats = colstats[col];
     double down = frac - std::floor(frac);
     double cost;
 
-    if (nsamplesdown[col] == 0 || nsamplesdown[col] < minreliable) {
-      double weightPs = nsamplesdown[col] == 0
+    if (stats.nsamplesdown == 0 || stats.nsamplesdown < minreliable) {
+      double weightPs = stats.nsamplesdown == 0
                             ? 0
-                            : 0.9 + 0.1 * nsamplesdown[col] /
+                            : 0.9 + 0.1 * stats.nsamplesdown /
                                         static_cast<double>(minreliable);
-      cost = weightPs * pseudocostdown[col];
+      cost = weightPs * stats.pseudocostdown;
       cost += (1.0 - weightPs) * getAvgPseudocost();
     } else
-      cost = pseudocostdown[col];
+      cost = stats.pseudocostdown;
 
     return down * (offset + cost);
   }
 
   double getPseudocostUp(HighsInt col, double frac) const {
     double up = std::ceil(frac) - frac;
-    if (nsamplesup[col] == 0) return up * cost_total;
-    return up * pseudocostup[col];
+    if (colstats[col].nsamplesup == 0) return up * cost_total;
+    return up * colstats[col].pseudocostup;
   }
 
   double getPseudocostDown(HighsInt col, double frac) const {
     double down = frac - std::floor(frac);
-    if (nsamplesdown[col] == 0) return down * cost_total;
-    return down * pseudocostdown[col];
+    if (colstats[col].nsamplesdown == 0) return down * cost_total;
+    return down * colstats[col].pseudocostdown;
   }
 
   double getConflictScoreUp(HighsInt col) const {
-    return conflictscoreup[col] / conflict_weight;
+    return colstats[col].conflictscoreup / conflict_weight;
   }
 
   double getConflictScoreDown(HighsInt col) const {
-    return conflictscoredown[col] / conflict_weight;
+    return colstats[col].conflictscoredown / conflict_weight;
   }
 
   double getScore(HighsInt col, double upcost, double downcost) const {
-    double costScore = std::max(upcost, 1e-6) * std::max(downcost, 1e-6) /
-                       std::max(1e-6, cost_total * cost_total);
-    double inferenceScore = std::max(inferencesup[col], 1e-6) *
-                            std::max(inferencesdown[col], 1e-6) /
-                            std::max(1e-6, inferences_total * inferences_total);
-
-    double cutOffScoreUp =
-        ncutoffsup[col] /
-        std::max(1.0, static_cast<double>(ncutoffsup[col]) +
-                          static_cast<double>(nsamplesup[col]));
-    double cutOffScoreDown =
-        ncutoffsdown[col] /
-        std::max(1.0, static_cast<double>(ncutoffsdown[col]) +
-                          static_cast<double>(nsamplesdown[col]));
-    double avgCutoffs = static_cast<double>(ncutoffstotal) /
-                        std::max(1.0, static_cast<double>(ncutoffstotal) +
-                                          static_cast<double>(nsamplestotal));
-
-    double cutoffScore = std::max(cutOffScoreUp, 1e-6) *
-                         std::max(cutOffScoreDown, 1e-6) /
-                         std::max(1e-6, avgCutoffs * avgCutoffs);
-
-    double conflictScoreUp = conflictscoreup[col] / conflict_weight;
-    double conflictScoreDown = conflictscoredown[col] / conflict_weight;
-    double conflictScoreAvg =
-        conflict_avg_score /
-        (conflict_weight * static_cast<double>(conflictscoreup.size()));
-    double conflictScore = std::max(conflictScoreUp, 1e-6) *
-                           std::max(conflictScoreDown, 1e-6) /
-                           std::max(1e-6, conflictScoreAvg * conflictScoreAvg);
-
-    auto mapScore = [](double score) { return 1.0 - 1.0 / (1.0 + score); };
-    return mapScore(costScore) / degeneracyFactor +
-           degeneracyFactor *
-               (1e-2 * mapScore(conflictScore) +
-                1e-4 * (mapScore(cutoffScore) + mapScore(inferenceScore)));
+    return getScore(colstats[col], getScoreNormalization(), upcost, downcost);
   }
 
   double getScore(HighsInt col, double frac) const {
@@ -296,26 +339,38 @@ class HighsPseudocost {
     return getScore(col, upcost, downcost);
   }
 
+  /// scores the columns cols[i] for the costs upcost[i] and downcost[i] in one
+  /// pass. The result equals calling getScore() for each column, but the
+  /// normalization that all columns share is only computed once
+  void getScores(const std::vector<HighsInt>& cols,
+                 const std::vector<double>& upcost,
+                 const std::vector<double>& downcost,
+                 std::vector<double>& scores) const {
+    HighsInt numCols = cols.size();
+    assert((HighsInt)upcost.size() >= numCols);
+    assert((HighsInt)downcost.size() >= numCols);
+    scores.resize(numCols);
+
+    const ScoreNormalization norm = getScoreNormalization();
+    for (HighsInt i = 0; i != numCols; ++i)
+      scores[i] = getScore(colstats[cols[i]], norm, upcost[i], downcost[i]);
+  }
+
   double getScoreUp(HighsInt col, double frac) const {
+    const ColStats& stats = colstats[col];
     double costScore = getPseudocostUp(col, frac) / std::max(1e-6, cost_total);
     double inferenceScore =
-        inferencesup[col] / std::max(1e-6, inferences_total);
+        stats.inferencesup / std::max(1e-6, inferences_total);
 
     double cutOffScoreUp =
-        ncutoffsup[col] /
-        std::max(1.0, static_cast<double>(ncutoffsup[col]) +
-                          static_cast<double>(nsamplesup[col]));
-    double avgCutoffs = static_cast<double>(ncutoffstotal) /
-                        std::max(1.0, static_cast<double>(ncutoffstotal) +
-                                          static_cast<double>(nsamplestotal));
+        stats.ncutoffsup /
+        std::max(1.0, static_cast<double>(stats.ncutoffsup) +
+                          static_cast<double>(stats.nsamplesup));
+    double cutoffScore = cutOffScoreUp / std::max(1e-6, getAvgCutoffs());
 
-    double cutoffScore = cutOffScoreUp / std::max(1e-6, avgCutoffs);
-
-    double conflictScoreUp = conflictscoreup[col] / conflict_weight;
-    double conflictScoreAvg =
-        conflict_avg_score /
-        (conflict_weight * static_cast<double>(conflictscoreup.size()));
-    double conflictScore = conflictScoreUp / std::max(1e-6, conflictScoreAvg);
+    double conflictScoreUp = stats.conflictscoreup / conflict_weight;
+    double conflictScore =
+        conflictScoreUp / std::max(1e-6, getAvgConflictScore());
 
     auto mapScore = [](double score) { return 1.0 - 1.0 / (1.0 + score); };
 
@@ -325,26 +380,21 @@ class HighsPseudocost {
   }
 
   double getScoreDown(HighsInt col, double frac) const {
+    const ColStats& stats = colstats[col];
     double costScore =
         getPseudocostDown(col, frac) / std::max(1e-6, cost_total);
     double inferenceScore =
-        inferencesdown[col] / std::max(1e-6, inferences_total);
+        stats.inferencesdown / std::max(1e-6, inferences_total);
 
     double cutOffScoreDown =
-        ncutoffsdown[col] /
-        std::max(1.0, static_cast<double>(ncutoffsdown[col]) +
-                          static_cast<double>(nsamplesdown[col]));
-    double avgCutoffs = static_cast<double>(ncutoffstotal) /
-                        std::max(1.0, static_cast<double>(ncutoffstotal) +
-                                          static_cast<double>(nsamplestotal));
-
-    double cutoffScore = cutOffScoreDown / std::max(1e-6, avgCutoffs);
+        stats.ncutoffsdown /
+        std::max(1.0, static_cast<double>(stats.ncutoffsdown) +
+                          static_cast<double>(stats.nsamplesdown));
+    double cutoffScore = cutOffScoreDown / std::max(1e-6, getAvgCutoffs());
 
-    double conflictScoreDown = conflictscoredown[col] / conflict_weight;
-    double conflictScoreAvg =
-        conflict_avg_score /
-        (conflict_weight * static_cast<double>(conflictscoredown.size()));
-    double conflictScore = conflictScoreDown / std::max(1e-6, conflictScoreAvg);
+    double conflictScoreDown = stats.conflictscoredown / conflict_weight;
+    double conflictScore =
+        conflictScoreDown / std::max(1e-6, getAvgConflictScore());
 
     auto mapScore = [](double score) { return 1.0 - 1.0 / (1.0 + score); };
 
@@ -353,10 +403,12 @@ class HighsPseudocost {
             1e-4 * (mapScore(cutoffScore) + mapScore(inferenceScore)));
   }
 
-  double getAvgInferencesUp(HighsInt col) const { return inferencesup[col]; }
+  double getAvgInferencesUp(HighsInt col) const {
+    return colstats[col].inferencesup;
+  }
 
   double getAvgInferencesDown(HighsInt col) const {
-    return inferencesdown[col];
+    return colstats[col].inferencesdown;
   }
 };
 
@@ -10,12 +10,59 @@
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 #include "mip/HighsSearch.h"
 
+#include <algorithm>
 #include <numeric>
 
 #include "lp_data/HConst.h"
 #include "mip/HighsCutGeneration.h"
 #include "mip/HighsDomainChange.h"
 #include "mip/HighsMipSolverData.h"
+#include "parallel/HighsParallel.h"
+
+// maximal depth of the search tree up to which strong branching candidates
+// are evaluated in parallel on copies of the LP relaxation
+constexpr HighsInt kParallelStrongBranchingMaxDepth = 3;
+
+namespace {
+struct StrongBranchingLp {
+  HighsInt candidate;
+  bool upbranch;
+  std::vector<HighsInt> cols;
+  std::vector<double> lower;
+  std::vector<double> upper;
+  HighsInt iterations = 0;
+  bool optimal = false;
+  std::vector<double> sol;
+
+  // solve the LP of the child node warm started from the basis of the node
+  // on the private LP copy of a task, whose column bounds equal those of the
+  // node on entry and are restored on exit, so that it can run concurrently
+  // to others
+  void solve(Highs& childlp, const Highs& nodelp, double feastol) {
+    const HighsLp& lpmodel = nodelp.getLp();
+    childlp.setBasis(nodelp.getBasis());
+    childlp.changeColsBounds(cols.size(), cols.data(), lower.data(),
+                             upper.data());
+    childlp.run();
+
+    const HighsInfo& info = childlp.getInfo();
+    iterations = std::max(HighsInt{0}, info.simplex_iteration_count);
+    optimal = childlp.getModelStatus() == HighsModelStatus::kOptimal &&
+              info.max_primal_infeasibility <= feastol &&
+              info.max_dual_infeasibility <= feastol;
+    if (optimal) sol = childlp.getSolution().col_value;
+
+    std::vector<double> nodelower(cols.size());
+    std::vector<double> nodeupper(cols.size());
+    for (size_t i = 0; i != cols.size(); ++i) {
+      nodelower[i] = lpmodel.col_lower_[cols[i]];
+      nodeupper[i] = lpmodel.col_upper_[cols[i]];
+    }
+    childlp.changeColsBounds(cols.size(), cols.data(), nodelower.data(),
+                             nodeupper.data());
+  }
+};
+}  // namespace
 
 HighsSearch::HighsSearch(HighsMipSolver& mipsolver, HighsPseudocost& pseudocost)
     : mipsolver(mipsolver),
@@ -30,6 +77,7 @@ HighsSearch::HighsSearch(HighsMipSolver& mipsolver, HighsPseudocost& pseudocost)
   sblpiterations = 0;
   upper_limit = kHighsInf;
   inheuristic = false;
+  incrementalNodeSwitch = false;
   inbranching = false;
   countTreeWeight = true;
   childselrule = mipsolver.submip ? ChildSelectionRule::kHybridInferenceCost
@@ -338,6 +386,11 @@ HighsInt HighsSearch::selectBranchingCandidate(int64_t maxSbIters,
 
   double minScore = mipsolver.mipdata_->feastol;
 
+  std::vector<HighsInt> scorecols;
+  std::vector<double> scoreup;
+  std::vector<double> scoredown;
+  std::vector<double> scores;
+
   auto selectBestScore = [&](bool finalSelection) {
     HighsInt best = -1;
     double bestscore = -1.0;
@@ -345,8 +398,40 @@ HighsInt HighsSearch::selectBranchingCandidate(int64_t maxSbIters,
     int64_t bestnumnodes = 0;
 
     double oldminscore = minScore;
-    for (HighsInt k : evalqueue) {
-      double score;
+
+    // collect the costs of all candidates first so that they are scored in
+    // one pass. Candidates without a finite cost in one direction get an
+    // infinite score unless this is the final selection
+    HighsInt numeval = evalqueue.size();
+    scorecols.resize(numeval);
+    scoreup.resize(numeval);
+    scoredown.resize(numeval);
+    for (HighsInt i = 0; i != numeval; ++i) {
+      HighsInt k = evalqueue[i];
+      scorecols[i] = fracints[k].first;
+      if (upscore[k] <= oldminscore || downscore[k] <= oldminscore) {
+        scoreup[i] = std::min(upscore[k], oldminscore);
+        scoredown[i] = std::min(downscore[k], oldminscore);
+      } else if (upscore[k] == kHighsInf || downscore[k] == kHighsInf) {
+        if (finalSelection) {
+          scoreup[i] =
+              pseudocost.getPseudocostUp(fracints[k].first, fracints[k].second);
+          scoredown[i] = pseudocost.getPseudocostDown(fracints[k].first,
+                                                      fracints[k].second);
+        } else {
+          scoreup[i] = kHighsInf;
+          scoredown[i] = kHighsInf;
+        }
+      } else {
+        scoreup[i] = upscore[k];
+        scoredown[i] = downscore[k];
+      }
+    }
+    pseudocost.getScores(scorecols, scoreup, scoredown, scores);
+
+    for (HighsInt i = 0; i != numeval; ++i) {
+      HighsInt k = evalqueue[i];
+      double score = scoreup[i] == kHighsInf ? kHighsInf : scores[i];
 
       if (upscore[k] <= oldminscore) upscorereliable[k] = true;
       if (downscore[k] <= oldminscore) downscorereliable[k] = true;
@@ -355,19 +440,6 @@ HighsInt HighsSearch::selectBranchingCandidate(int64_t maxSbIters,
                                  downscorereliable[k] ? downscore[k] : 0);
       minScore = std::max(s, minScore);
 
-      if (upscore[k] <= oldminscore || downscore[k] <= oldminscore)
-        score = pseudocost.getScore(fracints[k].first,
-                                    std::min(upscore[k], oldminscore),
-                                    std::min(downscore[k], oldminscore));
-      else {
-        score = upscore[k] == kHighsInf || downscore[k] == kHighsInf
-                    ? finalSelection ? pseudocost.getScore(fracints[k].first,
-                                                           fracints[k].second)
-                                     : kHighsInf
-                    : pseudocost.getScore(fracints[k].first, upscore[k],
-                                          downscore[k]);
-      }
-
       assert(score >= 0.0);
       int64_t upnodes = numNodesUp(k);
       int64_t downnodes = numNodesDown(k);
@@ -390,6 +462,14 @@ HighsInt HighsSearch::selectBranchingCandidate(int64_t maxSbIters,
     return best;
   };
 
+  if (!inheuristic && !mipsolver.submip &&
+      getCurrentDepth() <= kParallelStrongBranchingMaxDepth &&
+      highs::parallel::num_threads() > 1 &&
+      getStrongBranchingLpIterations() < maxSbIters &&
+      !mipsolver.mipdata_->checkLimits())
+    evalBranchCandsInParallel(maxSbIters, upscore, downscore, upscorereliable,
+                              downscorereliable, upbound, downbound);
+
   HighsLpRelaxation::Playground playground = lp->playground();
 
   while (true) {
@@ -805,6 +885,190 @@ HighsInt HighsSearch::selectBranchingCandidate(int64_t maxSbIters,
   }
 }
 
+void HighsSearch::evalBranchCandsInParallel(
+    int64_t maxSbIters, std::vector<double>& upscore,
+    std::vector<double>& downscore, std::vector<uint8_t>& upscorereliable,
+    std::vector<uint8_t>& downscorereliable, std::vector<double>& upbound,
+    std::vector<double>& downbound) {
+  const auto& fracints = lp->getFractionalIntegers();
+  HighsInt numfrac = fracints.size();
+
+  // pick the unreliable candidates with the best pseudocost score, one per
+  // thread, so that the evaluation order stays independent of the timing
+  std::vector<std::pair<double, HighsInt>> candidates;
+  for (HighsInt k = 0; k != numfrac; ++k) {
+    if (upscorereliable[k] && downscorereliable[k]) continue;
+    candidates.emplace_back(
+        -pseudocost.getScore(fracints[k].first, fracints[k].second), k);
+  }
+
+  if (candidates.size() < 2) return;
+  std::sort(candidates.begin(), candidates.end());
+  candidates.resize(std::min(candidates.size(),
+                             size_t(highs::parallel::num_threads())));
+
+  // propagate the branching bound change of each child on the local domain
+  // and record the resulting bounds of the integer columns for its LP
+  std::vector<StrongBranchingLp> childlps;
+  for (const auto& cand : candidates) {
+    HighsInt k = cand.second;
+    HighsInt col = fracints[k].first;
+    for (bool upbranch : {false, true}) {
+      if (upbranch ? upscorereliable[k] : downscorereliable[k]) continue;
+
+      HighsInt numChangedCols = localdom.getChangedCols().size();
+      if (upbranch)
+        localdom.changeBound(HighsBoundType::kLower, col,
+                             std::ceil(fracints[k].second));
+      else
+        localdom.changeBound(HighsBoundType::kUpper, col,
+                             std::floor(fracints[k].second));
+      localdom.propagate();
+
+      // infeasible children are left to the sequential evaluation that
+      // derives the conflict and prunes the child
+      if (!localdom.infeasible()) {
+        childlps.emplace_back();
+        StrongBranchingLp& childlp = childlps.back();
+        childlp.candidate = k;
+        childlp.upbranch = upbranch;
+        const auto& changedcols = localdom.getChangedCols();
+        for (HighsInt i = numChangedCols; i < (HighsInt)changedcols.size();
+             ++i) {
+          HighsInt changedcol = changedcols[i];
+          if (mipsolver.variableType(changedcol) == HighsVarType::kContinuous)
+            continue;
+          childlp.cols.push_back(changedcol);
+          childlp.lower.push_back(localdom.col_lower_[changedcol]);
+          childlp.upper.push_back(localdom.col_upper_[changedcol]);
+        }
+      }
+
+      localdom.backtrack();
+      localdom.clearChangedCols(numChangedCols);
+    }
+  }
+
+  if (childlps.size() < 2) return;
+
+  lp->setObjectiveLimit(mipsolver.mipdata_->upper_limit);
+  const Highs& nodelp = lp->getLpSolver();
+  const double feastol = mipsolver.mipdata_->feastol;
+  const double timelimit =
+      mipsolver.options_mip_->time_limit -
+      mipsolver.timer_.read(mipsolver.timer_.solve_clock);
+  const HighsInt iterlimit = (HighsInt)std::min(
+      maxSbIters - getStrongBranchingLpIterations(), int64_t{kHighsIInf});
+
+  // bring the LP copies of the tasks up to date with the node LP: the model
+  // is only passed again when rows were added or removed since the last
+  // synchronization, otherwise the differing bounds and costs are changed
+  const HighsLp& lpmodel = nodelp.getLp();
+  const HighsInt numworkers = std::min(
+      (HighsInt)childlps.size(), (HighsInt)highs::parallel::num_threads());
+  while ((HighsInt)sbworkers.size() < numworkers) {
+    sbworkers.emplace_back(new StrongBranchingWorker());
+    sbworkers.back()->lpsolver.setOptionValue("output_flag", false);
+  }
+
+  std::vector<HighsInt> diffcols;
+  std::vector<double> difflower;
+  std::vector<double> diffupper;
+  std::vector<double> diffcost;
+  for (HighsInt w = 0; w != numworkers; ++w) {
+    StrongBranchingWorker& worker = *sbworkers[w];
+    Highs& workerlp = worker.lpsolver;
+    workerlp.passOptions(nodelp.getOptions());
+    if (worker.source != lp || worker.numRowChanges != lp->getNumRowChanges() ||
+        workerlp.getLp().num_row_ != lpmodel.num_row_) {
+      workerlp.passModel(lpmodel);
+      worker.source = lp;
+      worker.numRowChanges = lp->getNumRowChanges();
+    } else {
+      const HighsLp& workermodel = workerlp.getLp();
+      diffcols.clear();
+      difflower.clear();
+      diffupper.clear();
+      for (HighsInt i = 0; i != lpmodel.num_col_; ++i) {
+        if (workermodel.col_lower_[i] == lpmodel.col_lower_[i] &&
+            workermodel.col_upper_[i] == lpmodel.col_upper_[i])
+          continue;
+        diffcols.push_back(i);
+        difflower.push_back(lpmodel.col_lower_[i]);
+        diffupper.push_back(lpmodel.col_upper_[i]);
+      }
+      if (!diffcols.empty())
+        workerlp.changeColsBounds(diffcols.size(), diffcols.data(),
+                                  difflower.data(), diffupper.data());
+
+      diffcols.clear();
+      diffcost.clear();
+      for (HighsInt i = 0; i != lpmodel.num_col_; ++i) {
+        if (workermodel.col_cost_[i] == lpmodel.col_cost_[i]) continue;
+        diffcols.push_back(i);
+        diffcost.push_back(lpmodel.col_cost_[i]);
+      }
+      if (!diffcols.empty())
+        workerlp.changeColsCost(diffcols.size(), diffcols.data(),
+                                diffcost.data());
+    }
+    workerlp.setOptionValue("time_limit", workerlp.getRunTime() + timelimit);
+    workerlp.setOptionValue("simplex_iteration_limit", iterlimit);
+  }
+
+  // each task solves the children with its index modulo the number of tasks
+  // in order, so the results do not depend on the timing
+  highs::parallel::for_each(
+      0, numworkers,
+      [&](HighsInt start, HighsInt end) {
+        for (HighsInt w = start; w < end; ++w)
+          for (HighsInt i = w; i < (HighsInt)childlps.size(); i += numworkers)
+            childlps[i].solve(sbworkers[w]->lpsolver, nodelp, feastol);
+      },
+      1);
+
+  // merge the results in a fixed order; children that are cut off are left
+  // unreliable, so the sequential evaluation prunes them with full conflict
+  // analysis
+  for (StrongBranchingLp& childlp : childlps) {
+    lpiterations += childlp.iterations;
+    sblpiterations += childlp.iterations;
+    if (!childlp.optimal) continue;
+
+    HighsInt k = childlp.candidate;
+    HighsInt col = fracints[k].first;
+    double fracval = fracints[k].second;
+
+    bool integerfeasible;
+    double solobj = checkSol(childlp.sol, integerfeasible);
+    double objdelta = std::max(solobj - lp->getObjective(), 0.0);
+    if (objdelta <= mipsolver.mipdata_->epsilon) objdelta = 0.0;
+
+    if (integerfeasible) {
+      double cutoffbnd = getCutoffBound();
+      mipsolver.mipdata_->addIncumbent(childlp.sol, solobj, 'B');
+      if (mipsolver.mipdata_->upper_limit < cutoffbnd)
+        lp->setObjectiveLimit(mipsolver.mipdata_->upper_limit);
+    }
+
+    if (solobj > mipsolver.mipdata_->optimality_limit) continue;
+
+    if (childlp.upbranch) {
+      upscore[k] = objdelta;
+      upscorereliable[k] = true;
+      upbound[k] = solobj;
+      markBranchingVarUpReliableAtNode(col);
+      pseudocost.addObservation(col, std::ceil(fracval) - fracval, objdelta);
+    } else {
+      downscore[k] = objdelta;
+      downscorereliable[k] = true;
+      downbound[k] = solobj;
+      markBranchingVarDownReliableAtNode(col);
+      pseudocost.addObservation(col, std::floor(fracval) - fracval, objdelta);
+    }
+  }
+}
+
 const HighsSearch::NodeData* HighsSearch::getParentNodeData() const {
   if (nodestack.size() <= 1) return nullptr;
 
@@ -931,8 +1195,32 @@ void HighsSearch::resetLocalDomain() {
 #endif
 }
 
+void HighsSearch::backtrackSubtreeRoot() {
+  // with incremental node switching the domain of the subtree root is kept,
+  // so that installing the next node only backtracks to the common ancestor
+  if (!incrementalNodeSwitch || localdom.infeasible()) {
+    localdom.backtrackToGlobal();
+    return;
+  }
+
+  // bound changes that were dropped from the changed columns without being
+  // flushed, e.g. when propagating a node before putting it to the queue,
+  // would otherwise remain missing in the LP
+  const HighsLp& lpmodel = lp->getLpSolver().getLp();
+  for (const HighsDomainChange& domchg : localdom.getDomainChangeStack()) {
+    HighsInt col = domchg.column;
+    if (lpmodel.col_lower_[col] != localdom.col_lower_[col] ||
+        lpmodel.col_upper_[col] != localdom.col_upper_[col])
+      localdom.markChangedCol(col);
+  }
+}
+
 void HighsSearch::installNode(HighsNodeQueue::OpenNode&& node) {
-  localdom.setDomainChangeStack(node.domchgstack, node.branchings);
+  // only the bound changes below the common ancestor of the current and the
+  // new node are undone and flushed to the LP before the new node is applied
+  localdom.backtrackToCommonAncestor(node.domchgstack, node.branchings);
+  lp->flushDomain(localdom);
+  localdom.applyDomainChangeStack(node.domchgstack, node.branchings);
   bool globalSymmetriesValid = true;
   if (mipsolver.mipdata_->globalOrbits) {
     // if global orbits have been computed we check whether they are still valid
@@ -1595,7 +1883,7 @@ bool HighsSearch::backtrack(bool recoverBasis) {
         if (recoverBasis && nodestack.back().nodeBasis)
           lp->setStoredBasis(std::move(nodestack.back().nodeBasis));
         nodestack.pop_back();
-        localdom.backtrackToGlobal();
+        backtrackSubtreeRoot();
         lp->flushDomain(localdom);
         if (recoverBasis) lp->recoverBasis();
         return false;
@@ -1718,7 +2006,7 @@ bool HighsSearch::backtrackPlunge(HighsNodeQueue& nodequeue) {
         if (nodestack.back().nodeBasis)
           lp->setStoredBasis(std::move(nodestack.back().nodeBasis));
         nodestack.pop_back();
-        localdom.backtrackToGlobal();
+        backtrackSubtreeRoot();
         lp->flushDomain(localdom);
         lp->recoverBasis();
         return false;
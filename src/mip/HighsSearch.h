@@ -12,6 +12,7 @@
 #define HIGHS_SEARCH_H_
 
 #include <cstdint>
+#include <memory>
 #include <queue>
 #include <vector>
 
@@ -46,8 +47,19 @@ class HighsSearch {
   HighsInt depthoffset;
   bool inbranching;
   bool inheuristic;
+  bool incrementalNodeSwitch;
   bool countTreeWeight;
 
+  // private copy of the LP relaxation of a task evaluating strong branching
+  // children in parallel, kept across calls and only updated by the changes
+  // of the LP relaxation it was last synchronized with
+  struct StrongBranchingWorker {
+    Highs lpsolver;
+    const HighsLpRelaxation* source = nullptr;
+    int64_t numRowChanges = -1;
+  };
+  std::vector<std::unique_ptr<StrongBranchingWorker>> sbworkers;
+
  public:
   enum class ChildSelectionRule {
     kUp,
@@ -139,6 +151,8 @@ class HighsSearch {
 
   bool orbitsValidInChildNode(const HighsDomainChange& branchChg) const;
 
+  void backtrackSubtreeRoot();
+
  public:
   HighsSearch(HighsMipSolver& mipsolver, HighsPseudocost& pseudocost);
 
@@ -168,6 +182,14 @@ class HighsSearch {
     if (inheuristic) childselrule = ChildSelectionRule::kHybridInferenceCost;
   }
 
+  // keep the local domain of the last node when the search runs out of nodes,
+  // so that installNode() only replays the bound changes below the common
+  // ancestor of that node and the next one. The local domain then is only
+  // global when the search has no node after a call to resetLocalDomain()
+  void setIncrementalNodeSwitch(bool incrementalNodeSwitch) {
+    this->incrementalNodeSwitch = incrementalNodeSwitch;
+  }
+
   void addBoundExceedingConflict();
 
   void resetLocalDomain();
@@ -205,6 +227,14 @@ class HighsSearch {
   HighsInt selectBranchingCandidate(int64_t maxSbIters, double& downNodeLb,
                                     double& upNodeLb);
 
+  void evalBranchCandsInParallel(int64_t maxSbIters,
+                                 std::vector<double>& upscore,
+                                 std::vector<double>& downscore,
+                                 std::vector<uint8_t>& upscorereliable,
+                                 std::vector<uint8_t>& downscorereliable,
+                                 std::vector<double>& upbound,
+                                 std::vector<double>& downbound);
+
   void evalUnreliableBranchCands();
 
   const NodeData* getParentNodeData() const;
@@ -24,6 +24,7 @@
 #include "mip/HighsPathSeparator.h"
 #include "mip/HighsTableauSeparator.h"
 #include "mip/HighsTransformedLp.h"
+#include "parallel/HighsParallel.h"
 
 HighsSeparation::HighsSeparation(const HighsMipSolver& mipsolver) {
   implBoundClock = mipsolver.timer_.clock_def("Implbound sepa", "Ibd");
@@ -109,14 +110,21 @@ HighsInt HighsSeparation::separationRound(HighsDomain& propdomain,
     status = HighsLpRelaxation::Status::kInfeasible;
     return 0;
   }
-  HighsLpAggregator lpAggregator(*lp);
-
-  for (const std::unique_ptr<HighsSeparator>& separator : separators) {
-    separator->run(*lp, lpAggregator, transLp, mipdata.cutpool);
+  if (highs::parallel::num_threads() > 1) {
+    runSeparatorsInParallel(transLp);
     if (mipdata.domain.infeasible()) {
       status = HighsLpRelaxation::Status::kInfeasible;
       return 0;
     }
+  } else {
+    HighsLpAggregator lpAggregator(*lp);
+    for (const std::unique_ptr<HighsSeparator>& separator : separators) {
+      separator->run(*lp, lpAggregator, transLp, mipdata.cutpool);
+      if (mipdata.domain.infeasible()) {
+        status = HighsLpRelaxation::Status::kInfeasible;
+        return 0;
+      }
+    }
   }
 
   numboundchgs = propagateAndResolve();
@@ -129,6 +137,7 @@ HighsInt HighsSeparation::separationRound(HighsDomain& propdomain,
 
   if (cutset.numCuts() > 0) {
     ncuts += cutset.numCuts();
+    mipdata.num_separated_cuts += cutset.numCuts();
     lp->addCuts(cutset);
     status = lp->resolveLp(&propdomain);
     lp->performAging(true);
@@ -143,6 +152,40 @@ HighsInt HighsSeparation::separationRound(HighsDomain& propdomain,
   return ncuts;
 }
 
+void HighsSeparation::runSeparatorsInParallel(
+    const HighsTransformedLp& transLp) {
+  const HighsMipSolver& mipsolver = lp->getMipSolver();
+  HighsCutPool& cutpool = mipsolver.mipdata_->cutpool;
+  const HighsInt numSeparators = separators.size();
+
+  // The separators only read the LP relaxation, the global domain and the
+  // global cut pool. Each of them runs on its own copy of the transformed LP
+  // and its own aggregator and collects its cuts in its own pool
+  std::vector<HighsTransformedLp> sepaTransLps(numSeparators, transLp);
+  std::vector<HighsLpAggregator> sepaLpAggregators(numSeparators,
+                                                   HighsLpAggregator(*lp));
+  std::vector<std::unique_ptr<HighsCutPool>> sepaCutpools;
+  sepaCutpools.reserve(numSeparators);
+  for (HighsInt i = 0; i != numSeparators; ++i)
+    sepaCutpools.emplace_back(new HighsCutPool(
+        mipsolver.numCol(), mipsolver.options_mip_->mip_pool_age_limit,
+        mipsolver.options_mip_->mip_pool_soft_limit, &cutpool));
+
+  highs::parallel::for_each(0, numSeparators, [&](HighsInt start,
+                                                  HighsInt end) {
+    for (HighsInt i = start; i < end; ++i)
+      separators[i]->run(*lp, sepaLpAggregators[i], sepaTransLps[i],
+                         *sepaCutpools[i]);
+  });
+
+  // the cuts are added to the global cut pool in the order of the separators,
+  // so that the result does not depend on the number of threads
+  for (HighsInt i = 0; i != numSeparators; ++i) {
+    cutpool.addCutsFrom(mipsolver, *sepaCutpools[i]);
+    if (mipsolver.mipdata_->domain.infeasible()) return;
+  }
+}
+
 void HighsSeparation::separate(HighsDomain& propdomain) {
   HighsLpRelaxation::Status status = lp->getStatus();
   const HighsMipSolver& mipsolver = lp->getMipSolver();
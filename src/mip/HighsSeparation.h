@@ -34,6 +34,8 @@ class HighsSeparation {
   HighsSeparation(const HighsMipSolver& mipsolver);
 
  private:
+  void runSeparatorsInParallel(const HighsTransformedLp& transLp);
+
   HighsInt implBoundClock;
   HighsInt cliqueClock;
   std::vector<std::unique_ptr<HighsSeparator>> separators;
@@ -47,7 +47,10 @@ void HighsTableauSeparator::separateLpSolution(HighsLpRelaxation& lpRelaxation,
   if (!lpSolver.hasInvert()) return;
 
   const HighsMipSolver& mip = lpRelaxation.getMipSolver();
-  if (cutpool.getNumAvailableCuts() > mip.options_mip_->mip_pool_soft_limit)
+  // the given cut pool may only collect the cuts of this separator, so the
+  // limit is checked against the global cut pool
+  if (mip.mipdata_->cutpool.getNumAvailableCuts() >
+      mip.options_mip_->mip_pool_soft_limit)
     return;
 
   const HighsInt* basisinds =
@@ -0,0 +1,113 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2024 by Julian Hall, Ivet Galabova,    */
+/*    Leona Gottwald and Michael Feldmeier                               */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+#include "mip/HighsTreeSizeEstimator.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "lp_data/HConst.h"
+
+// values of the measures at the end of the tree search
+constexpr std::array<double, HighsTreeSizeEstimator::kNumMeasures>
+    kMeasureTarget = {1.0, 0.5, 0.0, 0.0};
+
+// smoothing factors of the level and the trend of the measures
+constexpr double kLevelSmoothing = 0.65;
+constexpr double kTrendSmoothing = 0.15;
+
+// samples are at least a minimal number of nodes and a fraction of the
+// processed nodes apart, and a measure gives a forecast after a minimal
+// number of samples
+constexpr int64_t kMinSampleDistance = 10;
+constexpr double kSampleDistanceRatio = 0.05;
+constexpr HighsInt kMinSamplesForForecast = 5;
+
+void HighsTreeSizeEstimator::reset(double time) {
+  series.fill(Series{0.0, 0.0, 0, 0});
+  forecast.fill(kHighsInf);
+  numNodes = 0;
+  startTime = time;
+  elapsedTime = 0.0;
+  subtreeGapsScale = 0.0;
+}
+
+void HighsTreeSizeEstimator::addSample(Measure measure, double value,
+                                       int64_t nodes) {
+  Series& s = series[measure];
+  if (s.numSamples == 0) {
+    s.level = value;
+    s.trend = 0.0;
+  } else {
+    double steps = double(nodes - s.nodes);
+    double lastLevel = s.level;
+    s.level = kLevelSmoothing * value +
+              (1.0 - kLevelSmoothing) * (s.level + s.trend * steps);
+    double slope = (s.level - lastLevel) / steps;
+    if (s.numSamples == 1)
+      s.trend = slope;
+    else
+      s.trend = kTrendSmoothing * slope + (1.0 - kTrendSmoothing) * s.trend;
+  }
+  s.nodes = nodes;
+  ++s.numSamples;
+
+  double distance = kMeasureTarget[measure] - s.level;
+  if (std::abs(distance) <= 1e-9)
+    forecast[measure] = 0.0;
+  else if (s.numSamples >= kMinSamplesForForecast && distance * s.trend > 0)
+    forecast[measure] = distance / s.trend;
+  else
+    forecast[measure] = kHighsInf;
+}
+
+void HighsTreeSizeEstimator::update(int64_t nodes, int64_t leaves,
+                                    double treeweight, double gap,
+                                    double subtreegaps, double time) {
+  int64_t minDistance = std::max(
+      kMinSampleDistance, int64_t(kSampleDistanceRatio * double(numNodes)));
+  if (nodes < numNodes + minDistance) return;
+
+  numNodes = nodes;
+  elapsedTime = time - startTime;
+
+  addSample(kTreeWeight, treeweight, nodes);
+  addSample(kLeafFrequency, double(leaves) / double(nodes), nodes);
+  addSample(kGap, std::min(std::max(gap, 0.0), 1.0), nodes);
+
+  // the sum of subtree gaps is only defined with an incumbent and is scaled
+  // by its value at the first sample
+  if (subtreegaps >= 0.0 && subtreegaps < kHighsInf) {
+    if (subtreeGapsScale == 0.0) subtreeGapsScale = subtreegaps;
+    if (subtreeGapsScale > 0.0)
+      addSample(kSubtreeGaps, subtreegaps / subtreeGapsScale, nodes);
+  }
+}
+
+double HighsTreeSizeEstimator::getRemainingNodes() const {
+  std::array<double, kNumMeasures> forecasts;
+  HighsInt numForecasts = 0;
+  for (double f : forecast)
+    if (f < kHighsInf) forecasts[numForecasts++] = f;
+
+  if (numForecasts == 0) return kHighsInf;
+
+  std::sort(forecasts.begin(), forecasts.begin() + numForecasts);
+  HighsInt mid = numForecasts / 2;
+  if (numForecasts % 2 == 1) return forecasts[mid];
+  return 0.5 * (forecasts[mid - 1] + forecasts[mid]);
+}
+
+double HighsTreeSizeEstimator::getRemainingTime() const {
+  double remainingNodes = getRemainingNodes();
+  if (remainingNodes == kHighsInf || numNodes == 0) return kHighsInf;
+
+  return remainingNodes * elapsedTime / double(numNodes);
+}
@@ -0,0 +1,83 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2024 by Julian Hall, Ivet Galabova,    */
+/*    Leona Gottwald and Michael Feldmeier                               */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**@file mip/HighsTreeSizeEstimator.h
+ * @brief Online estimation of the size of the branch-and-bound tree and of
+ * the remaining time of the tree search
+ */
+
+#ifndef HIGHS_TREE_SIZE_ESTIMATOR_H_
+#define HIGHS_TREE_SIZE_ESTIMATOR_H_
+
+#include <array>
+#include <cstdint>
+
+#include "util/HighsInt.h"
+
+/// Each measure of the search progress reaches a known value when the tree
+/// search is complete: the explored tree weight reaches one, the frequency of
+/// leaves among the processed nodes one half, and the gap as well as the sum
+/// of the gaps of the open subtrees zero. The estimator samples the measures
+/// as the search proceeds and extrapolates each of them with a double
+/// exponential smoothing over the number of processed nodes. The estimate of
+/// the remaining nodes is the median of the forecasts of the measures
+class HighsTreeSizeEstimator {
+ public:
+  enum Measure {
+    kTreeWeight = 0,
+    kLeafFrequency,
+    kGap,
+    kSubtreeGaps,
+    kNumMeasures,
+  };
+
+ private:
+  struct Series {
+    double level;
+    double trend;
+    int64_t nodes;
+    HighsInt numSamples;
+  };
+
+  std::array<Series, kNumMeasures> series;
+  std::array<double, kNumMeasures> forecast;
+  int64_t numNodes;
+  double startTime;
+  double elapsedTime;
+  double subtreeGapsScale;
+
+  void addSample(Measure measure, double value, int64_t nodes);
+
+ public:
+  HighsTreeSizeEstimator() { reset(0.0); }
+
+  /// starts the estimation for a new run of the tree search
+  void reset(double time);
+
+  /// samples the measures after the given number of nodes and leaves of the
+  /// current run were processed. The gap is relative and at most one and the
+  /// sum of subtree gaps is not normalized. Samples that follow the previous
+  /// one too closely are skipped
+  void update(int64_t nodes, int64_t leaves, double treeweight, double gap,
+              double subtreegaps, double time);
+
+  /// forecast of the nodes that remain to be processed according to one
+  /// measure, or infinity when the measure does not progress
+  double getRemainingNodes(Measure measure) const { return forecast[measure]; }
+
+  /// estimate of the nodes that remain to be processed in the current run,
+  /// or infinity when no measure gives a forecast yet
+  double getRemainingNodes() const;
+
+  /// estimate of the remaining time of the current run of the tree search
+  double getRemainingTime() const;
+};
+
+#endif
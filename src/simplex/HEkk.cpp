@@ -429,6 +429,18 @@ void HEkk::ftran(HVector& rhs, const double expected_density) {
   simplex_nla_.ftran(rhs, expected_density);
 }
 
+void HEkk::btranMulti(std::vector<HVector*>& rhs,
+                      const std::vector<double>& expected_density) {
+  assert(status_.has_nla);
+  simplex_nla_.btranMulti(rhs, expected_density);
+}
+
+void HEkk::ftranMulti(std::vector<HVector*>& rhs,
+                      const std::vector<double>& expected_density) {
+  assert(status_.has_nla);
+  simplex_nla_.ftranMulti(rhs, expected_density);
+}
+
 void HEkk::moveLp(HighsLpSolverObject& solver_object) {
   // Move the incumbent LP to EKK
   HighsLp& incumbent_lp = solver_object.lp_;
@@ -1494,7 +1506,10 @@ HighsStatus HEkk::initialiseSimplexLpBasisAndFactor(
   // basis to use
   if (only_from_known_basis) assert(status_.has_basis);
   // If there is no simplex basis, set up a logical basis
-  if (!status_.has_basis) setBasis();
+  if (!status_.has_basis) {
+    setBasis();
+    crash();
+  }
   // The simplex NLA operates in the scaled space if the LP has
   // scaling factors. If they exist but haven't been applied, then the
   // simplex NLA needs a separate, scaled constraint matrix. Thus
@@ -2874,16 +2889,41 @@ void HEkk::tableauRowPrice(const bool quad_precision, const HVector& row_ep,
     }
   }
   row_ap.clear();
+  // Determine whether PRICE can be performed in parallel: it's not
+  // worth it unless the LP is large and row_ep is not sparse
+  const HighsInt num_price_task =
+      HighsTaskExecutor::getThisWorkerDeque() != nullptr
+          ? highs::parallel::num_threads()
+          : 1;
+  const bool parallel_price = !quad_precision && num_price_task > 1 &&
+                              solver_num_col >= kParallelPriceMinNumCol &&
+                              local_density >= kParallelPriceMinDensity;
+  if (parallel_price) setupPricePartialResult(num_price_task);
   if (use_col_price) {
     // Perform column-wise PRICE
-    lp_.a_matrix_.priceByColumn(quad_precision, row_ap, row_ep, debug_report);
+    if (parallel_price) {
+      lp_.a_matrix_.priceByColumnParallel(row_ap, row_ep,
+                                          price_partial_result_);
+    } else {
+      lp_.a_matrix_.priceByColumn(quad_precision, row_ap, row_ep,
+                                  debug_report);
+    }
   } else if (use_row_price_w_switch) {
     // Perform hyper-sparse row-wise PRICE, but switch if the density of row_ap
     // becomes extreme
     const double switch_density = kHyperPriceDensity;
-    ar_matrix_.priceByRowWithSwitch(quad_precision, row_ap, row_ep,
-                                    info_.row_ap_density, 0, switch_density,
-                                    debug_report);
+    if (parallel_price && options_->simplex_price_row_parallel &&
+        info_.row_ap_density > switch_density) {
+      // Historical density means that hyper-sparse PRICE would not be
+      // used, so perform standard row-wise PRICE in parallel. Its
+      // partial results are summed in an order that depends on the
+      // number of threads, so this is only done when requested
+      ar_matrix_.priceByRowParallel(row_ap, row_ep, price_partial_result_);
+    } else {
+      ar_matrix_.priceByRowWithSwitch(quad_precision, row_ap, row_ep,
+                                      info_.row_ap_density, 0, switch_density,
+                                      debug_report);
+    }
   } else {
     // Perform hyper-sparse row-wise PRICE
     ar_matrix_.priceByRow(quad_precision, row_ap, row_ep, debug_report);
@@ -2904,6 +2944,16 @@ void HEkk::tableauRowPrice(const bool quad_precision, const HVector& row_ep,
   analysis_.simplexTimerStop(PriceClock);
 }
 
+void HEkk::setupPricePartialResult(const HighsInt num_price_task) {
+  const HighsInt num_col = lp_.num_col_;
+  if ((HighsInt)price_partial_result_.size() == num_price_task &&
+      price_partial_result_[0].size == num_col)
+    return;
+  price_partial_result_.resize(num_price_task);
+  for (HVector& partial_result : price_partial_result_)
+    partial_result.setup(num_col);
+}
+
 void HEkk::fullPrice(const HVector& full_col, HVector& full_row) {
   analysis_.simplexTimerStart(PriceFullClock);
   full_row.clear();
@@ -55,6 +55,10 @@ class HEkk {
   void clearHotStart();
   void btran(HVector& rhs, const double expected_density);
   void ftran(HVector& rhs, const double expected_density);
+  void btranMulti(std::vector<HVector*>& rhs,
+                  const std::vector<double>& expected_density);
+  void ftranMulti(std::vector<HVector*>& rhs,
+                  const std::vector<double>& expected_density);
 
   void moveLp(HighsLpSolverObject& solver_object);
   void setPointers(HighsCallback* callback, HighsOptions* options,
@@ -148,6 +152,8 @@ class HEkk {
   HighsRandom random_;
   std::vector<double> dual_edge_weight_;
   std::vector<double> scattered_dual_edge_weight_;
+  // Partial results for parallel PRICE
+  std::vector<HVector> price_partial_result_;
 
   bool simplex_in_scaled_space_;
   HighsSparseMatrix ar_matrix_;
@@ -218,6 +224,7 @@ class HEkk {
   void updateSimplexOptions();
   void initialiseSimplexLpRandomVectors();
   void setNonbasicMove();
+  void crash();
   bool getNonsingularInverse(const HighsInt solve_phase = 0);
   bool getBacktrackingBasis();
   void putBacktrackingBasis();
@@ -257,6 +264,7 @@ class HEkk {
   void tableauRowPrice(const bool quad_precision, const HVector& row_ep,
                        HVector& row_ap,
                        const HighsInt debug_report = kDebugReportOff);
+  void setupPricePartialResult(const HighsInt num_price_task);
   void fullPrice(const HVector& full_col, HVector& full_row);
   void computePrimal();
   void computeDual();
@@ -0,0 +1,308 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2024 by Julian Hall, Ivet Galabova,    */
+/*    Leona Gottwald and Michael Feldmeier                               */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**@file simplex/HEkkCrash.cpp
+ * @brief Crash procedures that replace logicals of the initial basis by
+ * structurals so that the basis matrix stays triangular
+ */
+
+#include <algorithm>
+#include <set>
+#include <tuple>
+
+#include "simplex/HEkk.h"
+#include "simplex/SimplexTimer.h"
+#include "util/HighsHash.h"
+
+namespace {
+
+// An entry is only accepted as a pivot of the triangular crash if it is at
+// least this fraction of the largest entry of its column
+const double kCrashRelativePivotTolerance = 0.1;
+
+// Bixby's crash takes a column as pivot of a row with a large entry, and
+// otherwise only if its entries in rows with a pivot are small
+const double kBixbyLargeEntry = 0.99;
+const double kBixbySmallEntry = 0.01;
+
+// The priority of a variable to be basic: free variables have the highest
+// priority, variables with one bound the next, boxed variables the next and
+// fixed variables never become basic. For a logical, the bounds of its row
+// are used
+HighsInt basicPriority(const double lower, const double upper) {
+  if (lower == upper) return 0;
+  if (!highs_isInfinity(-lower) && !highs_isInfinity(upper)) return 1;
+  if (!highs_isInfinity(-lower) || !highs_isInfinity(upper)) return 2;
+  return 3;
+}
+
+// Triangular crash that selects pivot rows with the fewest active entries and
+// pivots on the column of the row with the highest priority. All columns with
+// an entry in a pivot row are then removed, so that each pivot row has a
+// single entry among the columns that are selected after it. A logical is
+// replaced if the column has a higher priority or, when preferring
+// structurals, at least the same priority
+void triangularCrash(const HighsLp& lp, const bool order_by_priority,
+                     const bool prefer_structurals,
+                     std::vector<std::pair<HighsInt, HighsInt>>& pivots) {
+  const HighsInt num_col = lp.num_col_;
+  const HighsInt num_row = lp.num_row_;
+  const HighsSparseMatrix& a_matrix = lp.a_matrix_;
+  HighsSparseMatrix ar_matrix;
+  ar_matrix.createRowwise(a_matrix);
+
+  std::vector<HighsInt> col_priority(num_col);
+  std::vector<double> col_max_value(num_col, 0.0);
+  std::vector<HighsInt> col_count(num_col, 0);
+  std::vector<bool> col_active(num_col);
+  for (HighsInt iCol = 0; iCol < num_col; iCol++) {
+    col_priority[iCol] =
+        basicPriority(lp.col_lower_[iCol], lp.col_upper_[iCol]);
+    col_active[iCol] = col_priority[iCol] > 0;
+    for (HighsInt iEl = a_matrix.start_[iCol]; iEl < a_matrix.start_[iCol + 1];
+         iEl++)
+      col_max_value[iCol] =
+          std::max(std::fabs(a_matrix.value_[iEl]), col_max_value[iCol]);
+  }
+
+  // Rows whose logical is free keep it basic
+  std::vector<HighsInt> row_priority(num_row);
+  std::vector<HighsInt> row_count(num_row, 0);
+  std::vector<bool> row_active(num_row);
+  for (HighsInt iRow = 0; iRow < num_row; iRow++) {
+    row_priority[iRow] =
+        basicPriority(-lp.row_upper_[iRow], -lp.row_lower_[iRow]);
+    row_active[iRow] = row_priority[iRow] < 3;
+    if (!row_active[iRow]) continue;
+    for (HighsInt iEl = ar_matrix.start_[iRow];
+         iEl < ar_matrix.start_[iRow + 1]; iEl++) {
+      HighsInt iCol = ar_matrix.index_[iEl];
+      if (!col_active[iCol]) continue;
+      row_count[iRow]++;
+      col_count[iCol]++;
+    }
+  }
+
+  // Active rows with at least one active entry, ordered by their priority
+  // and count
+  using RowKey = std::tuple<HighsInt, HighsInt, HighsInt>;
+  auto rowKey = [&](HighsInt iRow) {
+    return order_by_priority
+               ? RowKey(row_priority[iRow], row_count[iRow], iRow)
+               : RowKey(row_count[iRow], row_priority[iRow], iRow);
+  };
+  std::set<RowKey> row_queue;
+  for (HighsInt iRow = 0; iRow < num_row; iRow++)
+    if (row_active[iRow] && row_count[iRow] > 0) row_queue.insert(rowKey(iRow));
+
+  auto removeRow = [&](HighsInt iRow) {
+    row_active[iRow] = false;
+    if (row_count[iRow] > 0) row_queue.erase(rowKey(iRow));
+    for (HighsInt iEl = ar_matrix.start_[iRow];
+         iEl < ar_matrix.start_[iRow + 1]; iEl++) {
+      HighsInt iCol = ar_matrix.index_[iEl];
+      if (col_active[iCol]) col_count[iCol]--;
+    }
+  };
+  auto removeCol = [&](HighsInt iCol) {
+    col_active[iCol] = false;
+    for (HighsInt iEl = a_matrix.start_[iCol]; iEl < a_matrix.start_[iCol + 1];
+         iEl++) {
+      HighsInt iRow = a_matrix.index_[iEl];
+      if (!row_active[iRow]) continue;
+      row_queue.erase(rowKey(iRow));
+      row_count[iRow]--;
+      if (row_count[iRow] > 0) row_queue.insert(rowKey(iRow));
+    }
+  };
+
+  while (!row_queue.empty()) {
+    const HighsInt iRow = std::get<2>(*row_queue.begin());
+
+    // Choose the column of highest priority, then with the fewest active
+    // entries, then with the largest entry
+    HighsInt pivot_col = -1;
+    std::tuple<HighsInt, HighsInt, double> best_key;
+    for (HighsInt iEl = ar_matrix.start_[iRow];
+         iEl < ar_matrix.start_[iRow + 1]; iEl++) {
+      HighsInt iCol = ar_matrix.index_[iEl];
+      if (!col_active[iCol]) continue;
+      if (col_priority[iCol] < row_priority[iRow]) continue;
+      if (col_priority[iCol] == row_priority[iRow] && !prefer_structurals)
+        continue;
+      double value = std::fabs(ar_matrix.value_[iEl]);
+      if (value < kCrashRelativePivotTolerance * col_max_value[iCol]) continue;
+      std::tuple<HighsInt, HighsInt, double> key(col_priority[iCol],
+                                                 -col_count[iCol], value);
+      if (pivot_col < 0 || key > best_key) {
+        pivot_col = iCol;
+        best_key = key;
+      }
+    }
+
+    removeRow(iRow);
+    if (pivot_col < 0) continue;
+
+    pivots.emplace_back(iRow, pivot_col);
+    for (HighsInt iEl = ar_matrix.start_[iRow];
+         iEl < ar_matrix.start_[iRow + 1]; iEl++) {
+      HighsInt iCol = ar_matrix.index_[iEl];
+      if (col_active[iCol]) removeCol(iCol);
+    }
+  }
+}
+
+// Bixby's crash (ORSA Journal on Computing 4, 1992) replaces the logicals of
+// equality rows. Columns are considered in order of increasing penalty, given
+// by their bounds and their cost
+void bixbyCrash(const HighsLp& lp, const bool no_nonzero_cost_cols,
+                std::vector<std::pair<HighsInt, HighsInt>>& pivots) {
+  const HighsInt num_col = lp.num_col_;
+  const HighsInt num_row = lp.num_row_;
+  const HighsSparseMatrix& a_matrix = lp.a_matrix_;
+
+  // The number of selected columns with an entry in each row, counting the
+  // basic logicals, and the largest such entry
+  std::vector<HighsInt> row_count(num_row, 0);
+  std::vector<double> row_max_value(num_row, 0.0);
+  HighsInt num_uncovered_row = 0;
+  for (HighsInt iRow = 0; iRow < num_row; iRow++) {
+    if (lp.row_lower_[iRow] == lp.row_upper_[iRow]) {
+      num_uncovered_row++;
+    } else {
+      row_count[iRow] = 1;
+      row_max_value[iRow] = 1.0;
+    }
+  }
+  if (num_uncovered_row == 0) return;
+
+  double max_cost = 0.0;
+  for (HighsInt iCol = 0; iCol < num_col; iCol++)
+    max_cost = std::max(std::fabs(lp.col_cost_[iCol]), max_cost);
+  if (max_cost == 0.0) max_cost = 1.0;
+
+  std::vector<std::pair<double, HighsInt>> col_order;
+  for (HighsInt iCol = 0; iCol < num_col; iCol++) {
+    HighsInt priority = basicPriority(lp.col_lower_[iCol], lp.col_upper_[iCol]);
+    if (priority == 0) continue;
+    if (no_nonzero_cost_cols && lp.col_cost_[iCol] != 0.0) continue;
+    double penalty = (3 - priority) + lp.col_cost_[iCol] / max_cost;
+    col_order.emplace_back(penalty, iCol);
+  }
+  std::sort(col_order.begin(), col_order.end());
+
+  for (const std::pair<double, HighsInt>& entry : col_order) {
+    const HighsInt iCol = entry.second;
+    const HighsInt from_el = a_matrix.start_[iCol];
+    const HighsInt to_el = a_matrix.start_[iCol + 1];
+    double col_max_value = 0.0;
+    for (HighsInt iEl = from_el; iEl < to_el; iEl++)
+      col_max_value = std::max(std::fabs(a_matrix.value_[iEl]), col_max_value);
+    if (col_max_value == 0.0) continue;
+
+    HighsInt pivot_row = -1;
+    double pivot_value = 0.0;
+    bool small_in_covered_rows = true;
+    for (HighsInt iEl = from_el; iEl < to_el; iEl++) {
+      const HighsInt iRow = a_matrix.index_[iEl];
+      const double value = std::fabs(a_matrix.value_[iEl]);
+      if (row_count[iRow] == 0) {
+        if (value > pivot_value) {
+          pivot_row = iRow;
+          pivot_value = value;
+        }
+      } else if (value > kBixbySmallEntry * row_max_value[iRow]) {
+        small_in_covered_rows = false;
+      }
+    }
+    if (pivot_row < 0) continue;
+    if (pivot_value < kBixbyLargeEntry * col_max_value &&
+        !small_in_covered_rows)
+      continue;
+
+    pivots.emplace_back(pivot_row, iCol);
+    for (HighsInt iEl = from_el; iEl < to_el; iEl++) {
+      const HighsInt iRow = a_matrix.index_[iEl];
+      row_count[iRow]++;
+      row_max_value[iRow] =
+          std::max(std::fabs(a_matrix.value_[iEl]), row_max_value[iRow]);
+    }
+    if (--num_uncovered_row == 0) break;
+  }
+}
+
+}  // namespace
+
+void HEkk::crash() {
+  const HighsInt crash_strategy = options_->simplex_crash_strategy;
+  if (crash_strategy == kSimplexCrashStrategyOff) return;
+  assert(lp_.a_matrix_.isColwise());
+  analysis_.simplexTimerStart(CrashClock);
+
+  std::vector<std::pair<HighsInt, HighsInt>> pivots;
+  switch (crash_strategy) {
+    case kSimplexCrashStrategyLtssfK:
+      triangularCrash(lp_, false, false, pivots);
+      break;
+    case kSimplexCrashStrategyLtssfPri:
+      triangularCrash(lp_, true, false, pivots);
+      break;
+    case kSimplexCrashStrategyLtsfK:
+      triangularCrash(lp_, false, true, pivots);
+      break;
+    case kSimplexCrashStrategyLtsf:
+      // LTSF has no variant other than by row count and by row priority, so
+      // this strategy is kept as an alias of LTSF by row priority
+      highsLogUser(options_->log_options, HighsLogType::kInfo,
+                   "Simplex crash strategy %d is LTSF by row priority, as "
+                   "strategy %d\n",
+                   (int)kSimplexCrashStrategyLtsf,
+                   (int)kSimplexCrashStrategyLtsfPri);
+      triangularCrash(lp_, true, true, pivots);
+      break;
+    case kSimplexCrashStrategyLtsfPri:
+      triangularCrash(lp_, true, true, pivots);
+      break;
+    case kSimplexCrashStrategyBixby:
+      bixbyCrash(lp_, false, pivots);
+      break;
+    case kSimplexCrashStrategyBixbyNoNonzeroColCosts:
+      bixbyCrash(lp_, true, pivots);
+      break;
+    default:
+      highsLogDev(options_->log_options, HighsLogType::kWarning,
+                  "Simplex crash strategy %d is not implemented\n",
+                  (int)crash_strategy);
+      break;
+  }
+
+  if (!pivots.empty()) {
+    const HighsInt num_col = lp_.num_col_;
+    for (const std::pair<HighsInt, HighsInt>& pivot : pivots) {
+      const HighsInt iRow = pivot.first;
+      const HighsInt iCol = pivot.second;
+      assert(basis_.basicIndex_[iRow] == num_col + iRow);
+      basis_.nonbasicFlag_[iCol] = kNonbasicFlagFalse;
+      basis_.nonbasicFlag_[num_col + iRow] = kNonbasicFlagTrue;
+      basis_.basicIndex_[iRow] = iCol;
+    }
+    basis_.hash = 0;
+    for (HighsInt iRow = 0; iRow < lp_.num_row_; iRow++)
+      HighsHashHelpers::sparse_combine(basis_.hash, basis_.basicIndex_[iRow]);
+    basis_.debug_origin_name = "HEkk::crash";
+    info_.num_basic_logicals -= pivots.size();
+    setNonbasicMove();
+  }
+
+  analysis_.simplexTimerStop(CrashClock);
+  highsLogDev(options_->log_options, HighsLogType::kInfo,
+              "Crash strategy %d replaced %d of %d logicals by structurals\n",
+              (int)crash_strategy, (int)pivots.size(), (int)lp_.num_row_);
+}
@@ -1216,15 +1216,11 @@ void HEkkDual::iterate() {
 
   if (isBadBasisChange()) return;
 
+  // updateFtranMulti(); performs FTRAN-BFRT, the FTRAN that computes
+  // the pivotal column in the data structure "column" and the DSE FTRAN
+  // on pi_p together
   analysis->simplexTimerStart(IterateFtranClock);
-  updateFtranBFRT();
-
-  // updateFtran(); computes the pivotal column in the data structure "column"
-  updateFtran();
-
-  // updateFtranDSE performs the DSE FTRAN on pi_p
-  if (edge_weight_mode == EdgeWeightMode::kSteepestEdge)
-    updateFtranDSE(&row_ep);
+  updateFtranMulti();
   analysis->simplexTimerStop(IterateFtranClock);
 
   // updateVerify() Checks row-wise pivot against column-wise pivot for
@@ -2048,6 +2044,82 @@ void HEkkDual::updateFtranDSE(HVector* DSE_Vector) {
       local_row_DSE_density, ekk_instance_.info_.row_DSE_density);
 }
 
+void HEkkDual::updateFtranMulti() {
+  // Perform the FTRANs of updateFtranBFRT, updateFtran and, for steepest
+  // edge weights, updateFtranDSE(&row_ep) as one batched solve, so that the
+  // vectors taking the sparse solves with L and U share each pass through
+  // the factor. The arithmetic applied to each vector is that of the
+  // separate methods
+  //
+  // If reinversion is needed then skip this method
+  if (rebuild_reason) return;
+  analysis->simplexTimerStart(FtranClock);
+  const bool update_dse = edge_weight_mode == EdgeWeightMode::kSteepestEdge;
+  std::vector<HVector*> rhs;
+  std::vector<double> expected_density;
+
+  dualRow.updateFlip(&col_BFRT);
+  const bool ftran_bfrt = col_BFRT.count > 0;
+  if (ftran_bfrt) {
+    if (analysis->analyse_simplex_summary_data)
+      analysis->operationRecordBefore(kSimplexNlaFtranBfrt, col_BFRT,
+                                      ekk_instance_.info_.col_BFRT_density);
+    simplex_nla->applyBasisMatrixRowScale(col_BFRT);
+    rhs.push_back(&col_BFRT);
+    expected_density.push_back(ekk_instance_.info_.col_BFRT_density);
+  }
+
+  col_aq.clear();
+  col_aq.packFlag = true;
+  a_matrix->collectAj(col_aq, variable_in, 1);
+  if (analysis->analyse_simplex_summary_data)
+    analysis->operationRecordBefore(kSimplexNlaFtran, col_aq,
+                                    ekk_instance_.info_.col_aq_density);
+  simplex_nla->applyBasisMatrixRowScale(col_aq);
+  rhs.push_back(&col_aq);
+  expected_density.push_back(ekk_instance_.info_.col_aq_density);
+
+  if (update_dse) {
+    if (analysis->analyse_simplex_summary_data)
+      analysis->operationRecordBefore(kSimplexNlaFtranDse, row_ep,
+                                      ekk_instance_.info_.row_DSE_density);
+    // Apply R{-1}, see updateFtranDSE
+    simplex_nla->unapplyBasisMatrixRowScale(row_ep);
+    rhs.push_back(&row_ep);
+    expected_density.push_back(ekk_instance_.info_.row_DSE_density);
+  }
+
+  simplex_nla->ftranMultiInScaledSpace(rhs, expected_density,
+                                       analysis->pointer_serial_factor_clocks);
+
+  if (ftran_bfrt) {
+    simplex_nla->applyBasisMatrixColScale(col_BFRT);
+    if (analysis->analyse_simplex_summary_data)
+      analysis->operationRecordAfter(kSimplexNlaFtranBfrt, col_BFRT);
+  }
+  ekk_instance_.updateOperationResultDensity(
+      (double)col_BFRT.count / solver_num_row,
+      ekk_instance_.info_.col_BFRT_density);
+
+  simplex_nla->applyBasisMatrixColScale(col_aq);
+  if (analysis->analyse_simplex_summary_data)
+    analysis->operationRecordAfter(kSimplexNlaFtran, col_aq);
+  ekk_instance_.updateOperationResultDensity(
+      (double)col_aq.count / solver_num_row,
+      ekk_instance_.info_.col_aq_density);
+  // Save the pivot value computed column-wise - used for numerical checking
+  alpha_col = col_aq.array[row_out];
+
+  if (update_dse) {
+    if (analysis->analyse_simplex_summary_data)
+      analysis->operationRecordAfter(kSimplexNlaFtranDse, row_ep);
+    ekk_instance_.updateOperationResultDensity(
+        (double)row_ep.count / solver_num_row,
+        ekk_instance_.info_.row_DSE_density);
+  }
+  analysis->simplexTimerStop(FtranClock);
+}
+
 void HEkkDual::updateVerify() {
   // Compare the pivot value computed row-wise and column-wise and
   // determine whether reinversion is advisable
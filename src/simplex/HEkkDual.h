@@ -217,6 +217,12 @@ class HEkkDual {
    */
   void updateFtranDSE(HVector* DSE_Vector  //!< Pivotal column as RHS for FTRAN
   );
+
+  /**
+   * @brief Perform FTRAN, FTRAN-BFRT and, for steepest edge weights,
+   * FTRAN-DSE on row_ep as one batched solve
+   */
+  void updateFtranMulti();
   /**
    * @brief Compare the pivot value computed row-wise and column-wise
    * and determine whether reinversion is advisable
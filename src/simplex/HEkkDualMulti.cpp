@@ -26,6 +26,11 @@
 using std::cout;
 using std::endl;
 
+// Maximal number of vectors in a batched FTRAN or BTRAN of a PAMI task. The
+// batches are kept small so that the tasks remain balanced dynamically
+// between the threads
+const HighsInt kMultiSolveBatchSize = 2;
+
 void HEkkDual::iterateMulti() {
   slice_PRICE = 1;
 
@@ -201,33 +206,44 @@ void HEkkDual::majorChooseRowBtran() {
   // #pragma omp parallel for schedule(static, 1)
   // printf("start %d tasks for btran\n", multi_ntasks);
   // std::vector<HighsInt> tmp(multi_ntasks);
-  highs::parallel::for_each(0, multi_ntasks, [&](HighsInt start, HighsInt end) {
-    for (HighsInt i = start; i < end; i++) {
-      // printf("worker %d runs task %i\n", highs::parallel::thread_num(),
-      // i);
-      // tmp[i] = highs::parallel::thread_num();
-      const HighsInt iRow = multi_iRow[i];
-      HVector_ptr work_ep = multi_vector[i];
-      work_ep->clear();
-      work_ep->count = 1;
-      work_ep->index[0] = iRow;
-      work_ep->array[iRow] = 1;
-      work_ep->packFlag = true;
-      HighsTimerClock* factor_timer_clock_pointer =
-          analysis->getThreadFactorTimerClockPointer();
-      ekk_instance_.simplex_nla_.btran(*work_ep,
-                                       ekk_instance_.info_.row_ep_density,
-                                       factor_timer_clock_pointer);
-      if (edge_weight_mode == EdgeWeightMode::kSteepestEdge) {
-        // For Dual steepest edge we know the exact weight as the 2-norm of
-        // work_ep
-        multi_EdWt[i] = work_ep->norm2();
-      } else {
-        // For Devex (and Dantzig) we take the updated edge weight
-        multi_EdWt[i] = edge_weight[iRow];
-      }
-    }
-  });
+  //
+  // The tasks are performed as small batched BTRANs, so that the factor
+  // is swept once per batch
+  highs::parallel::for_each(
+      0, multi_ntasks,
+      [&](HighsInt start, HighsInt end) {
+        std::vector<HVector*> batch_ep;
+        for (HighsInt i = start; i < end; i++) {
+          // printf("worker %d runs task %i\n",
+          // highs::parallel::thread_num(), i); tmp[i] =
+          // highs::parallel::thread_num();
+          const HighsInt iRow = multi_iRow[i];
+          HVector_ptr work_ep = multi_vector[i];
+          work_ep->clear();
+          work_ep->count = 1;
+          work_ep->index[0] = iRow;
+          work_ep->array[iRow] = 1;
+          work_ep->packFlag = true;
+          batch_ep.push_back(work_ep);
+        }
+        const std::vector<double> batch_density(
+            end - start, ekk_instance_.info_.row_ep_density);
+        HighsTimerClock* factor_timer_clock_pointer =
+            analysis->getThreadFactorTimerClockPointer();
+        ekk_instance_.simplex_nla_.btranMulti(batch_ep, batch_density,
+                                              factor_timer_clock_pointer);
+        for (HighsInt i = start; i < end; i++) {
+          if (edge_weight_mode == EdgeWeightMode::kSteepestEdge) {
+            // For Dual steepest edge we know the exact weight as the
+            // 2-norm of work_ep
+            multi_EdWt[i] = multi_vector[i]->norm2();
+          } else {
+            // For Devex (and Dantzig) we take the updated edge weight
+            multi_EdWt[i] = edge_weight[multi_iRow[i]];
+          }
+        }
+      },
+      kMultiSolveBatchSize);
 
   // printf("multi_ntask task schedule:");
   // for (HighsInt i = 0; i < multi_ntasks; ++i) {
@@ -650,16 +666,21 @@ void HEkkDual::majorUpdateFtranParallel() {
   // Perform FTRAN
   // #pragma omp parallel for schedule(dynamic, 1)
   // printf("majorUpdateFtranParallel: starting %d tasks\n", multi_ntasks);
-  highs::parallel::for_each(0, multi_ntasks, [&](HighsInt start, HighsInt end) {
-    for (HighsInt i = start; i < end; i++) {
-      HVector_ptr rhs = multi_vector[i];
-      double density = multi_density[i];
-      HighsTimerClock* factor_timer_clock_pointer =
-          analysis->getThreadFactorTimerClockPointer();
-      ekk_instance_.simplex_nla_.ftran(*rhs, density,
-                                       factor_timer_clock_pointer);
-    }
-  });
+  //
+  // The tasks are performed as small batched FTRANs
+  highs::parallel::for_each(
+      0, multi_ntasks,
+      [&](HighsInt start, HighsInt end) {
+        std::vector<HVector*> batch_rhs(multi_vector + start,
+                                        multi_vector + end);
+        const std::vector<double> batch_density(multi_density + start,
+                                                multi_density + end);
+        HighsTimerClock* factor_timer_clock_pointer =
+            analysis->getThreadFactorTimerClockPointer();
+        ekk_instance_.simplex_nla_.ftranMulti(batch_rhs, batch_density,
+                                              factor_timer_clock_pointer);
+      },
+      kMultiSolveBatchSize);
 
   // Update ticks
   for (HighsInt iFn = 0; iFn < multi_nFinish; iFn++) {
@@ -113,6 +113,25 @@ void HSimplexNla::ftran(HVector& rhs, const double expected_density,
   applyBasisMatrixColScale(rhs);
 }
 
+void HSimplexNla::btranMulti(
+    std::vector<HVector*>& rhs, const std::vector<double>& expected_density,
+    HighsTimerClock* factor_timer_clock_pointer) const {
+  for (HVector* vector : rhs) {
+    applyBasisMatrixColScale(*vector);
+    frozenBtran(*vector);
+  }
+  factor_.btranMulti(rhs, expected_density, factor_timer_clock_pointer);
+  for (HVector* vector : rhs) applyBasisMatrixRowScale(*vector);
+}
+
+void HSimplexNla::ftranMulti(
+    std::vector<HVector*>& rhs, const std::vector<double>& expected_density,
+    HighsTimerClock* factor_timer_clock_pointer) const {
+  for (HVector* vector : rhs) applyBasisMatrixRowScale(*vector);
+  ftranMultiInScaledSpace(rhs, expected_density, factor_timer_clock_pointer);
+  for (HVector* vector : rhs) applyBasisMatrixColScale(*vector);
+}
+
 void HSimplexNla::btranInScaledSpace(
     HVector& rhs, const double expected_density,
     HighsTimerClock* factor_timer_clock_pointer) const {
@@ -127,6 +146,13 @@ void HSimplexNla::ftranInScaledSpace(
   frozenFtran(rhs);
 }
 
+void HSimplexNla::ftranMultiInScaledSpace(
+    std::vector<HVector*>& rhs, const std::vector<double>& expected_density,
+    HighsTimerClock* factor_timer_clock_pointer) const {
+  factor_.ftranMulti(rhs, expected_density, factor_timer_clock_pointer);
+  for (HVector* vector : rhs) frozenFtran(*vector);
+}
+
 void HSimplexNla::frozenBtran(HVector& rhs) const {
   HighsInt frozen_basis_id = last_frozen_basis_id_;
   if (frozen_basis_id == kNoLink) return;
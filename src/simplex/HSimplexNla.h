@@ -79,12 +79,21 @@ class HSimplexNla {
              HighsTimerClock* factor_timer_clock_pointer = NULL) const;
   void ftran(HVector& rhs, const double expected_density,
              HighsTimerClock* factor_timer_clock_pointer = NULL) const;
+  void btranMulti(std::vector<HVector*>& rhs,
+                  const std::vector<double>& expected_density,
+                  HighsTimerClock* factor_timer_clock_pointer = NULL) const;
+  void ftranMulti(std::vector<HVector*>& rhs,
+                  const std::vector<double>& expected_density,
+                  HighsTimerClock* factor_timer_clock_pointer = NULL) const;
   void btranInScaledSpace(
       HVector& rhs, const double expected_density,
       HighsTimerClock* factor_timer_clock_pointer = NULL) const;
   void ftranInScaledSpace(
       HVector& rhs, const double expected_density,
       HighsTimerClock* factor_timer_clock_pointer = NULL) const;
+  void ftranMultiInScaledSpace(
+      std::vector<HVector*>& rhs, const std::vector<double>& expected_density,
+      HighsTimerClock* factor_timer_clock_pointer = NULL) const;
   void frozenBtran(HVector& rhs) const;
   void frozenFtran(HVector& rhs) const;
   void update(HVector* aq, HVector* ep, HighsInt* iRow, HighsInt* hint);
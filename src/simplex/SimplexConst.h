@@ -164,6 +164,12 @@ const double kAcceptDseWeightThreshold = 0.25;
 
 const double kMinDualSteepestEdgeWeight = 1e-4;
 
+// PRICE is performed in parallel when there is more than one thread,
+// the LP has at least this number of columns and the density of
+// row_ep is at least this value
+const HighsInt kParallelPriceMinNumCol = 1000;
+const double kParallelPriceMinDensity = 0.1;
+
 const HighsInt kNoRowSought = -2;
 const HighsInt kNoRowChosen = -1;
 
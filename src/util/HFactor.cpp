@@ -17,8 +17,10 @@
 #include <iostream>
 
 #include "lp_data/HConst.h"
+#include "parallel/HighsParallel.h"
 #include "pdqsort/pdqsort.h"
 #include "util/FactorTimer.h"
+#include "util/HFactorConst.h"
 #include "util/HFactorDebug.h"
 #include "util/HVector.h"
 #include "util/HVectorBase.h"
@@ -286,6 +288,7 @@ void HFactor::setupGeneral(
   mwz_column_mark.assign(num_row, 0);
   mwz_column_index.resize(num_row);
   mwz_column_array.assign(num_row, 0);
+  mwz_column_position.resize(num_row);
 
   // Allocate space for count-link-list
   const HighsInt col_link_max_count = num_row;
@@ -515,6 +518,135 @@ void HFactor::btranCall(std::vector<double>& vector,
   vector = std::move(this->rhs_.array);
 }
 
+void HFactor::ftranMulti(std::vector<HVector*>& vectors,
+                         const std::vector<double>& expected_density,
+                         HighsTimerClock* factor_timer_clock_pointer) const {
+  const HighsInt num_vector = vectors.size();
+  assert((HighsInt)expected_density.size() == num_vector);
+  if (update_method != kUpdateMethodFt || num_vector <= 1) {
+    // The batched sweeps are only implemented for the FT update, and
+    // offer nothing for a single RHS
+    for (HighsInt iVec = 0; iVec < num_vector; iVec++)
+      ftranCall(*vectors[iVec], expected_density[iVec],
+                factor_timer_clock_pointer);
+    return;
+  }
+  FactorTimer factor_timer;
+  factor_timer.start(FactorFtran, factor_timer_clock_pointer);
+  std::vector<bool> use_indices(num_vector);
+  std::vector<HVector*> sparse_vectors;
+  // 1. Lower part: vectors for which a hyper-sparse solve is
+  // indicated are solved individually
+  for (HighsInt iVec = 0; iVec < num_vector; iVec++) {
+    HVector& rhs = *vectors[iVec];
+    use_indices[iVec] = rhs.count >= 0;
+    const double current_density = 1.0 * rhs.count / num_row;
+    const bool sparse_solve = rhs.count < 0 ||
+                              current_density > kHyperCancel ||
+                              expected_density[iVec] > kHyperFtranL;
+    if (sparse_solve) {
+      sparse_vectors.push_back(&rhs);
+    } else {
+      ftranL(rhs, expected_density[iVec], factor_timer_clock_pointer);
+    }
+  }
+  factor_timer.start(FactorFtranLower, factor_timer_clock_pointer);
+  ftranLMulti(sparse_vectors);
+  factor_timer.stop(FactorFtranLower, factor_timer_clock_pointer);
+  // 2. Upper part: the FT updates are applied to each vector before
+  // determining the style of solve with U
+  sparse_vectors.clear();
+  factor_timer.start(FactorFtranUpper, factor_timer_clock_pointer);
+  for (HighsInt iVec = 0; iVec < num_vector; iVec++) {
+    HVector& rhs = *vectors[iVec];
+    ftranFT(rhs);
+    rhs.tight();
+    rhs.pack();
+    const double current_density = 1.0 * rhs.count / num_row;
+    const bool sparse_solve = rhs.count < 0 ||
+                              current_density > kHyperCancel ||
+                              expected_density[iVec] > kHyperFtranU;
+    if (sparse_solve) {
+      sparse_vectors.push_back(&rhs);
+    } else {
+      solveHyper(num_row, u_pivot_lookup.data(), u_pivot_index.data(),
+                 u_pivot_value.data(), u_start.data(), u_last_p.data(),
+                 u_index.data(), u_value.data(), &rhs);
+    }
+  }
+  ftranUMulti(sparse_vectors);
+  factor_timer.stop(FactorFtranUpper, factor_timer_clock_pointer);
+  // Possibly find the indices in order
+  for (HighsInt iVec = 0; iVec < num_vector; iVec++)
+    if (use_indices[iVec]) vectors[iVec]->reIndex();
+  factor_timer.stop(FactorFtran, factor_timer_clock_pointer);
+}
+
+void HFactor::btranMulti(std::vector<HVector*>& vectors,
+                         const std::vector<double>& expected_density,
+                         HighsTimerClock* factor_timer_clock_pointer) const {
+  const HighsInt num_vector = vectors.size();
+  assert((HighsInt)expected_density.size() == num_vector);
+  if (update_method != kUpdateMethodFt || num_vector <= 1) {
+    for (HighsInt iVec = 0; iVec < num_vector; iVec++)
+      btranCall(*vectors[iVec], expected_density[iVec],
+                factor_timer_clock_pointer);
+    return;
+  }
+  FactorTimer factor_timer;
+  factor_timer.start(FactorBtran, factor_timer_clock_pointer);
+  std::vector<bool> use_indices(num_vector);
+  std::vector<HVector*> sparse_vectors;
+  // 1. Upper part, followed by the FT updates for each vector
+  factor_timer.start(FactorBtranUpper, factor_timer_clock_pointer);
+  for (HighsInt iVec = 0; iVec < num_vector; iVec++) {
+    HVector& rhs = *vectors[iVec];
+    use_indices[iVec] = rhs.count >= 0;
+    const double current_density = 1.0 * rhs.count / num_row;
+    const bool sparse_solve = rhs.count < 0 ||
+                              current_density > kHyperCancel ||
+                              expected_density[iVec] > kHyperBtranU;
+    if (sparse_solve) {
+      sparse_vectors.push_back(&rhs);
+    } else {
+      solveHyper(num_row, u_pivot_lookup.data(), u_pivot_index.data(),
+                 u_pivot_value.data(), ur_start.data(), ur_lastp.data(),
+                 ur_index.data(), ur_value.data(), &rhs);
+    }
+  }
+  btranUMulti(sparse_vectors);
+  for (HighsInt iVec = 0; iVec < num_vector; iVec++) {
+    HVector& rhs = *vectors[iVec];
+    assert(rhs.count >= 0);
+    rhs.tight();
+    rhs.pack();
+    btranFT(rhs);
+    rhs.tight();
+  }
+  factor_timer.stop(FactorBtranUpper, factor_timer_clock_pointer);
+  // 2. Lower part
+  sparse_vectors.clear();
+  for (HighsInt iVec = 0; iVec < num_vector; iVec++) {
+    HVector& rhs = *vectors[iVec];
+    const double current_density = 1.0 * rhs.count / num_row;
+    const bool sparse_solve = rhs.count < 0 ||
+                              current_density > kHyperCancel ||
+                              expected_density[iVec] > kHyperBtranL;
+    if (sparse_solve) {
+      sparse_vectors.push_back(&rhs);
+    } else {
+      btranL(rhs, expected_density[iVec], factor_timer_clock_pointer);
+    }
+  }
+  factor_timer.start(FactorBtranLower, factor_timer_clock_pointer);
+  btranLMulti(sparse_vectors);
+  factor_timer.stop(FactorBtranLower, factor_timer_clock_pointer);
+  // Possibly find the indices in order
+  for (HighsInt iVec = 0; iVec < num_vector; iVec++)
+    if (use_indices[iVec]) vectors[iVec]->reIndex();
+  factor_timer.stop(FactorBtran, factor_timer_clock_pointer);
+}
+
 void HFactor::update(HVector* aq, HVector* ep, HighsInt* iRow, HighsInt* hint) {
   // Updating implies a change of basis. Since the refactorizaion info
   // no longer corresponds to the current basis, it must be
@@ -885,6 +1017,17 @@ HighsInt HFactor::buildKernel() {
   double average_iteration_time = 0;
   const bool check_for_timeout = this->time_limit_ < kHighsInf;
   HighsInt search_k = 0;
+  // The columns of the pivot row can be updated concurrently when the
+  // task scheduler runs with more than one thread
+  const bool parallel_elimination =
+      HighsTaskExecutor::getThisWorkerDeque() != nullptr &&
+      highs::parallel::num_threads() > 1;
+  // Count the active rows of the kernel, so that a switch to a dense
+  // factorization can be made once the remaining kernel is dense
+  HighsInt num_active_row = 0;
+  for (HighsInt iRow = 0; iRow < num_row; iRow++)
+    if (mr_count[iRow] > 0) num_active_row++;
+  bool dense_kernel = false;
 
   const HighsInt check_nwork = -11;
   while (nwork-- > 0) {
@@ -911,6 +1054,21 @@ HighsInt HFactor::buildKernel() {
         return kBuildKernelReturnTimeout;
     }
 
+    // Switch to a dense factorization if the remaining kernel is
+    // small enough and every active column has a large enough count
+    if (nwork + 1 >= kDenseKernelMinDim && nwork + 1 <= kDenseKernelMaxDim &&
+        num_active_row <= kDenseKernelMaxDim) {
+      const double min_dense_count = kDenseKernelMinDensity * num_active_row;
+      HighsInt min_col_count = 1;
+      while (min_col_count < min_dense_count &&
+             col_link_first[min_col_count] < 0)
+        min_col_count++;
+      if (min_col_count >= min_dense_count) {
+        dense_kernel = true;
+        break;
+      }
+    }
+
     /**
      * 1. Search for the pivot
      */
@@ -1099,6 +1257,7 @@ HighsInt HFactor::buildKernel() {
       continue;
     }
     permute[jColPivot] = iRowPivot;
+    num_active_row--;
     assert(mc_var[jColPivot] == basic_index[jColPivot]);
 
     this->refactor_info_.pivot_row.push_back(iRowPivot);
@@ -1138,103 +1297,110 @@ HighsInt HFactor::buildKernel() {
     // 2.4. Loop over pivot row to eliminate other column
     const HighsInt row_start = mr_start[iRowPivot];
     const HighsInt row_end = row_start + mr_count[iRowPivot];
-    for (HighsInt row_k = row_start; row_k < row_end; row_k++) {
-      // 2.4.1. My pointer
-      HighsInt iCol = mr_index[row_k];
-      const HighsInt my_count = mc_count_a[iCol];
-      const HighsInt my_start = mc_start[iCol];
-      const HighsInt my_end = my_start + my_count - 1;
-      double my_pivot = colDelete(iCol, iRowPivot);
-      colStoreN(iCol, iRowPivot, my_pivot);
-
-      // 2.4.2. Elimination on the overlapping part
-      HighsInt nFillin = mwz_column_count;
-      HighsInt nCancel = 0;
-      for (HighsInt my_k = my_start; my_k < my_end; my_k++) {
-        HighsInt iRow = mc_index[my_k];
-        double value = mc_value[my_k];
-        if (mwz_column_mark[iRow]) {
-          mwz_column_mark[iRow] = 0;
-          nFillin--;
-          value -= my_pivot * mwz_column_array[iRow];
-          if (fabs(value) < kHighsTiny) {
-            value = 0;
-            nCancel++;
+    if (parallel_elimination && row_end - row_start > kBuildParallelGrainSize &&
+        1.0 * (row_end - row_start) * mwz_column_count >=
+            kBuildParallelMinWork) {
+      fake_eliminate +=
+          buildKernelParallelEliminate(iRowPivot, mwz_column_count);
+    } else {
+      for (HighsInt row_k = row_start; row_k < row_end; row_k++) {
+        // 2.4.1. My pointer
+        HighsInt iCol = mr_index[row_k];
+        const HighsInt my_count = mc_count_a[iCol];
+        const HighsInt my_start = mc_start[iCol];
+        const HighsInt my_end = my_start + my_count - 1;
+        double my_pivot = colDelete(iCol, iRowPivot);
+        colStoreN(iCol, iRowPivot, my_pivot);
+
+        // 2.4.2. Elimination on the overlapping part
+        HighsInt nFillin = mwz_column_count;
+        HighsInt nCancel = 0;
+        for (HighsInt my_k = my_start; my_k < my_end; my_k++) {
+          HighsInt iRow = mc_index[my_k];
+          double value = mc_value[my_k];
+          if (mwz_column_mark[iRow]) {
+            mwz_column_mark[iRow] = 0;
+            nFillin--;
+            value -= my_pivot * mwz_column_array[iRow];
+            if (fabs(value) < kHighsTiny) {
+              value = 0;
+              nCancel++;
+            }
+            mc_value[my_k] = value;
           }
-          mc_value[my_k] = value;
         }
-      }
-      fake_eliminate += mwz_column_count;
-      fake_eliminate += nFillin * 2;
-
-      // 2.4.3. Remove cancellation gaps
-      if (nCancel > 0) {
-        HighsInt new_end = my_start;
-        for (HighsInt my_k = my_start; my_k < my_end; my_k++) {
-          if (mc_value[my_k] != 0) {
-            mc_index[new_end] = mc_index[my_k];
-            mc_value[new_end++] = mc_value[my_k];
-          } else {
-            rowDelete(iCol, mc_index[my_k]);
+        fake_eliminate += mwz_column_count;
+        fake_eliminate += nFillin * 2;
+
+        // 2.4.3. Remove cancellation gaps
+        if (nCancel > 0) {
+          HighsInt new_end = my_start;
+          for (HighsInt my_k = my_start; my_k < my_end; my_k++) {
+            if (mc_value[my_k] != 0) {
+              mc_index[new_end] = mc_index[my_k];
+              mc_value[new_end++] = mc_value[my_k];
+            } else {
+              rowDelete(iCol, mc_index[my_k]);
+            }
           }
+          mc_count_a[iCol] = new_end - my_start;
         }
-        mc_count_a[iCol] = new_end - my_start;
-      }
 
-      // 2.4.4. Insert fill-in
-      if (nFillin > 0) {
-        // 2.4.4.1 Check column size
-        if (mc_count_a[iCol] + mc_count_n[iCol] + nFillin > mc_space[iCol]) {
-          // p1&2=active, p3&4=non active, p5=new p1, p7=new p3
-          HighsInt p1 = mc_start[iCol];
-          HighsInt p2 = p1 + mc_count_a[iCol];
-          HighsInt p3 = p1 + mc_space[iCol] - mc_count_n[iCol];
-          HighsInt p4 = p1 + mc_space[iCol];
-          mc_space[iCol] += max(mc_space[iCol], nFillin);
-          HighsInt p5 = mc_start[iCol] = mc_index.size();
-          HighsInt p7 = p5 + mc_space[iCol] - mc_count_n[iCol];
-          mc_index.resize(p5 + mc_space[iCol]);
-          mc_value.resize(p5 + mc_space[iCol]);
-          copy(&mc_index[p1], &mc_index[p2], &mc_index[p5]);
-          copy(&mc_value[p1], &mc_value[p2], &mc_value[p5]);
-          copy(&mc_index[p3], &mc_index[p4], &mc_index[p7]);
-          copy(&mc_value[p3], &mc_value[p4], &mc_value[p7]);
-        }
+        // 2.4.4. Insert fill-in
+        if (nFillin > 0) {
+          // 2.4.4.1 Check column size
+          if (mc_count_a[iCol] + mc_count_n[iCol] + nFillin > mc_space[iCol]) {
+            // p1&2=active, p3&4=non active, p5=new p1, p7=new p3
+            HighsInt p1 = mc_start[iCol];
+            HighsInt p2 = p1 + mc_count_a[iCol];
+            HighsInt p3 = p1 + mc_space[iCol] - mc_count_n[iCol];
+            HighsInt p4 = p1 + mc_space[iCol];
+            mc_space[iCol] += max(mc_space[iCol], nFillin);
+            HighsInt p5 = mc_start[iCol] = mc_index.size();
+            HighsInt p7 = p5 + mc_space[iCol] - mc_count_n[iCol];
+            mc_index.resize(p5 + mc_space[iCol]);
+            mc_value.resize(p5 + mc_space[iCol]);
+            copy(&mc_index[p1], &mc_index[p2], &mc_index[p5]);
+            copy(&mc_value[p1], &mc_value[p2], &mc_value[p5]);
+            copy(&mc_index[p3], &mc_index[p4], &mc_index[p7]);
+            copy(&mc_value[p3], &mc_value[p4], &mc_value[p7]);
+          }
 
-        // 2.4.4.2 Fill into column copy
-        for (HighsInt i = 0; i < mwz_column_count; i++) {
-          HighsInt iRow = mwz_column_index[i];
-          if (mwz_column_mark[iRow])
-            colInsert(iCol, iRow, -my_pivot * mwz_column_array[iRow]);
-        }
+          // 2.4.4.2 Fill into column copy
+          for (HighsInt i = 0; i < mwz_column_count; i++) {
+            HighsInt iRow = mwz_column_index[i];
+            if (mwz_column_mark[iRow])
+              colInsert(iCol, iRow, -my_pivot * mwz_column_array[iRow]);
+          }
 
-        // 2.4.4.3 Fill into the row copy
-        for (HighsInt i = 0; i < mwz_column_count; i++) {
-          HighsInt iRow = mwz_column_index[i];
-          if (mwz_column_mark[iRow]) {
-            // Expand row space
-            if (mr_count[iRow] == mr_space[iRow]) {
-              HighsInt p1 = mr_start[iRow];
-              HighsInt p2 = p1 + mr_count[iRow];
-              HighsInt p3 = mr_start[iRow] = mr_index.size();
-              mr_space[iRow] *= 2;
-              mr_index.resize(p3 + mr_space[iRow]);
-              copy(&mr_index[p1], &mr_index[p2], &mr_index[p3]);
+          // 2.4.4.3 Fill into the row copy
+          for (HighsInt i = 0; i < mwz_column_count; i++) {
+            HighsInt iRow = mwz_column_index[i];
+            if (mwz_column_mark[iRow]) {
+              // Expand row space
+              if (mr_count[iRow] == mr_space[iRow]) {
+                HighsInt p1 = mr_start[iRow];
+                HighsInt p2 = p1 + mr_count[iRow];
+                HighsInt p3 = mr_start[iRow] = mr_index.size();
+                mr_space[iRow] *= 2;
+                mr_index.resize(p3 + mr_space[iRow]);
+                copy(&mr_index[p1], &mr_index[p2], &mr_index[p3]);
+              }
+              rowInsert(iCol, iRow);
             }
-            rowInsert(iCol, iRow);
           }
         }
-      }
 
-      // 2.4.5. Reset pivot column mark
-      for (HighsInt i = 0; i < mwz_column_count; i++)
-        mwz_column_mark[mwz_column_index[i]] = 1;
+        // 2.4.5. Reset pivot column mark
+        for (HighsInt i = 0; i < mwz_column_count; i++)
+          mwz_column_mark[mwz_column_index[i]] = 1;
 
-      // 2.4.6. Fix max value and link list
-      colFixMax(iCol);
-      if (my_count != mc_count_a[iCol]) {
-        clinkDel(iCol);
-        clinkAdd(iCol, mc_count_a[iCol]);
+        // 2.4.6. Fix max value and link list
+        colFixMax(iCol);
+        if (my_count != mc_count_a[iCol]) {
+          clinkDel(iCol);
+          clinkAdd(iCol, mc_count_a[iCol]);
+        }
       }
     }
 
@@ -1253,10 +1419,311 @@ HighsInt HFactor::buildKernel() {
   }
   build_synthetic_tick +=
       fake_search * 20 + fake_fill * 160 + fake_eliminate * 80;
+  if (dense_kernel) return buildKernelDense(parallel_elimination);
   rank_deficiency = 0;
   return rank_deficiency;
 }
 
+double HFactor::buildKernelParallelEliminate(
+    const HighsInt iRowPivot, const HighsInt mwz_column_count) {
+  // Perform step 2.4 of buildKernel with the numerical work on the
+  // columns of the pivot row done concurrently. Only the column-wise
+  // data of each column is modified by its task, so the updates of
+  // the row-wise copy and the count link lists are applied afterwards
+  // in the order of the sequential loop, giving the same factors
+  const HighsInt row_start = mr_start[iRowPivot];
+  const HighsInt row_count = mr_count[iRowPivot];
+
+  // 2.4.1. Ensure that each column has space for the largest possible
+  // fill-in, so that no task has to extend mc_index and mc_value
+  for (HighsInt row_k = row_start; row_k < row_start + row_count; row_k++) {
+    const HighsInt iCol = mr_index[row_k];
+    if (mc_count_a[iCol] + mc_count_n[iCol] + mwz_column_count >
+        mc_space[iCol]) {
+      HighsInt p1 = mc_start[iCol];
+      HighsInt p2 = p1 + mc_count_a[iCol];
+      HighsInt p3 = p1 + mc_space[iCol] - mc_count_n[iCol];
+      HighsInt p4 = p1 + mc_space[iCol];
+      mc_space[iCol] += max(mc_space[iCol], mwz_column_count);
+      HighsInt p5 = mc_start[iCol] = mc_index.size();
+      HighsInt p7 = p5 + mc_space[iCol] - mc_count_n[iCol];
+      mc_index.resize(p5 + mc_space[iCol]);
+      mc_value.resize(p5 + mc_space[iCol]);
+      copy(&mc_index[p1], &mc_index[p2], &mc_index[p5]);
+      copy(&mc_value[p1], &mc_value[p2], &mc_value[p5]);
+      copy(&mc_index[p3], &mc_index[p4], &mc_index[p7]);
+      copy(&mc_value[p3], &mc_value[p4], &mc_value[p7]);
+    }
+  }
+  for (HighsInt i = 0; i < mwz_column_count; i++)
+    mwz_column_position[mwz_column_index[i]] = i;
+
+  // 2.4.2. Eliminate in each column, recording its count before the
+  // elimination and the number of cancellations and fill-ins. The
+  // marks of the pivot column rows are only read, and each task
+  // records the rows of the pivot column met in a column in its own
+  // buffer
+  std::vector<HighsInt> col_count(row_count);
+  std::vector<HighsInt> col_cancel(row_count);
+  std::vector<HighsInt> col_fillin(row_count);
+  highs::parallel::for_each(
+      0, row_count,
+      [&](HighsInt from_k, HighsInt to_k) {
+        std::vector<char> overlap(mwz_column_count);
+        for (HighsInt k = from_k; k < to_k; k++) {
+          const HighsInt iCol = mr_index[row_start + k];
+          const HighsInt my_count = mc_count_a[iCol];
+          const HighsInt my_start = mc_start[iCol];
+          const HighsInt my_end = my_start + my_count - 1;
+          double my_pivot = colDelete(iCol, iRowPivot);
+          colStoreN(iCol, iRowPivot, my_pivot);
+
+          std::fill(overlap.begin(), overlap.end(), 0);
+          HighsInt nFillin = mwz_column_count;
+          HighsInt nCancel = 0;
+          for (HighsInt my_k = my_start; my_k < my_end; my_k++) {
+            HighsInt iRow = mc_index[my_k];
+            if (!mwz_column_mark[iRow]) continue;
+            overlap[mwz_column_position[iRow]] = 1;
+            nFillin--;
+            double value = mc_value[my_k] - my_pivot * mwz_column_array[iRow];
+            if (fabs(value) < kHighsTiny) {
+              value = 0;
+              nCancel++;
+            }
+            mc_value[my_k] = value;
+          }
+
+          // Fill-in is added after the active entries, and moved when
+          // the cancellation gaps are removed
+          if (nFillin > 0) {
+            for (HighsInt i = 0; i < mwz_column_count; i++) {
+              if (overlap[i]) continue;
+              HighsInt iRow = mwz_column_index[i];
+              colInsert(iCol, iRow, -my_pivot * mwz_column_array[iRow]);
+            }
+          }
+          colFixMax(iCol);
+          col_count[k] = my_count;
+          col_cancel[k] = nCancel;
+          col_fillin[k] = nFillin;
+        }
+      },
+      kBuildParallelGrainSize);
+
+  // 2.4.3. Apply the changes to the row-wise copy and the count link
+  // lists in the order of the pivot row
+  double fake_eliminate = 0;
+  for (HighsInt k = 0; k < row_count; k++) {
+    const HighsInt iCol = mr_index[row_start + k];
+    const HighsInt my_count = col_count[k];
+    const HighsInt my_start = mc_start[iCol];
+    const HighsInt my_end = my_start + my_count - 1;
+    const HighsInt nFillin = col_fillin[k];
+    fake_eliminate += mwz_column_count;
+    fake_eliminate += nFillin * 2;
+
+    // Remove cancellation gaps, and move the fill-in to follow the
+    // remaining entries
+    HighsInt fill_start = my_end;
+    if (col_cancel[k] > 0) {
+      HighsInt new_end = my_start;
+      for (HighsInt my_k = my_start; my_k < my_end; my_k++) {
+        if (mc_value[my_k] != 0) {
+          mc_index[new_end] = mc_index[my_k];
+          mc_value[new_end++] = mc_value[my_k];
+        } else {
+          rowDelete(iCol, mc_index[my_k]);
+        }
+      }
+      for (HighsInt my_k = my_end; my_k < my_end + nFillin; my_k++) {
+        mc_index[new_end] = mc_index[my_k];
+        mc_value[new_end++] = mc_value[my_k];
+      }
+      mc_count_a[iCol] = new_end - my_start;
+      fill_start = new_end - nFillin;
+    }
+
+    // Fill into the row copy
+    for (HighsInt my_k = fill_start; my_k < fill_start + nFillin; my_k++) {
+      HighsInt iRow = mc_index[my_k];
+      // Expand row space
+      if (mr_count[iRow] == mr_space[iRow]) {
+        HighsInt p1 = mr_start[iRow];
+        HighsInt p2 = p1 + mr_count[iRow];
+        HighsInt p3 = mr_start[iRow] = mr_index.size();
+        mr_space[iRow] *= 2;
+        mr_index.resize(p3 + mr_space[iRow]);
+        copy(&mr_index[p1], &mr_index[p2], &mr_index[p3]);
+      }
+      rowInsert(iCol, iRow);
+    }
+
+    if (my_count != mc_count_a[iCol]) {
+      clinkDel(iCol);
+      clinkAdd(iCol, mc_count_a[iCol]);
+    }
+  }
+  return fake_eliminate;
+}
+
+HighsInt HFactor::buildKernelDense(const bool parallel_elimination) {
+  // Factorize the remaining kernel as a dense matrix with complete
+  // pivoting, so that rank deficiency is identified when the largest
+  // remaining entry is below the pivot tolerance. The dense matrix is
+  // held column-wise, and the pivot row and column are swapped into
+  // position so that each update runs over contiguous entries. The
+  // factors are stored as they would be by Markowitz pivoting, so the
+  // solves and updates are unchanged
+  const bool check_for_timeout = this->time_limit_ < kHighsInf;
+
+  // 1. Form the dense matrix from the active parts of the kernel
+  // columns without a pivot
+  std::vector<HighsInt> dense_col;
+  for (HighsInt i = 0; i < kernel_dim; i++)
+    if (permute[iwork[i]] < 0) dense_col.push_back(iwork[i]);
+  std::vector<HighsInt> dense_row;
+  std::vector<HighsInt> row_position(num_row, -1);
+  for (HighsInt iCol : dense_col) {
+    for (HighsInt k = mc_start[iCol]; k < mc_start[iCol] + mc_count_a[iCol];
+         k++) {
+      const HighsInt iRow = mc_index[k];
+      if (row_position[iRow] >= 0) continue;
+      row_position[iRow] = dense_row.size();
+      dense_row.push_back(iRow);
+    }
+  }
+  const HighsInt dense_num_col = dense_col.size();
+  const HighsInt dense_num_row = dense_row.size();
+  const HighsInt dense_dim = min(dense_num_col, dense_num_row);
+  std::vector<double> dense(size_t(dense_num_row) * dense_num_col, 0);
+  std::vector<double> col_max_value(dense_num_col, 0);
+  std::vector<HighsInt> col_max_position(dense_num_col, 0);
+  for (HighsInt j = 0; j < dense_num_col; j++) {
+    const HighsInt iCol = dense_col[j];
+    double* col = &dense[size_t(j) * dense_num_row];
+    for (HighsInt k = mc_start[iCol]; k < mc_start[iCol] + mc_count_a[iCol];
+         k++) {
+      const HighsInt i = row_position[mc_index[k]];
+      col[i] = mc_value[k];
+      if (fabs(col[i]) > col_max_value[j]) {
+        col_max_value[j] = fabs(col[i]);
+        col_max_position[j] = i;
+      }
+    }
+  }
+  double fake_eliminate = 0;
+
+  // 2. Eliminate with the largest remaining entry as pivot
+  HighsInt num_pivot = 0;
+  for (; num_pivot < dense_dim; num_pivot++) {
+    const HighsInt k = num_pivot;
+    if (check_for_timeout &&
+        build_timer_->readRunHighsClock() > this->time_limit_)
+      return kBuildKernelReturnTimeout;
+
+    // 2.1. Find the pivot and swap it into position
+    HighsInt pivot_j = k;
+    for (HighsInt j = k + 1; j < dense_num_col; j++)
+      if (col_max_value[j] > col_max_value[pivot_j]) pivot_j = j;
+    if (col_max_value[pivot_j] < pivot_tolerance) break;
+    const HighsInt pivot_i = col_max_position[pivot_j];
+    if (pivot_j != k) {
+      std::swap_ranges(dense.begin() + size_t(k) * dense_num_row,
+                       dense.begin() + size_t(k + 1) * dense_num_row,
+                       dense.begin() + size_t(pivot_j) * dense_num_row);
+      std::swap(dense_col[k], dense_col[pivot_j]);
+      std::swap(col_max_value[k], col_max_value[pivot_j]);
+      std::swap(col_max_position[k], col_max_position[pivot_j]);
+    }
+    if (pivot_i != k) {
+      for (HighsInt j = k; j < dense_num_col; j++)
+        std::swap(dense[size_t(j) * dense_num_row + k],
+                  dense[size_t(j) * dense_num_row + pivot_i]);
+      std::swap(dense_row[k], dense_row[pivot_i]);
+    }
+    const HighsInt jColPivot = dense_col[k];
+    const HighsInt iRowPivot = dense_row[k];
+    double* pivot_col = &dense[size_t(k) * dense_num_row];
+    const double pivot_multiplier = pivot_col[k];
+
+    permute[jColPivot] = iRowPivot;
+    assert(mc_var[jColPivot] == basic_index[jColPivot]);
+    this->refactor_info_.pivot_row.push_back(iRowPivot);
+    this->refactor_info_.pivot_var.push_back(basic_index[jColPivot]);
+    this->refactor_info_.pivot_type.push_back(kPivotMarkowitz);
+
+    // 2.2. Store the pivot column below the pivot to L
+    for (HighsInt i = k + 1; i < dense_num_row; i++) {
+      if (pivot_col[i] == 0) continue;
+      pivot_col[i] /= pivot_multiplier;
+      l_index.push_back(dense_row[i]);
+      l_value.push_back(pivot_col[i]);
+    }
+    l_start.push_back(l_index.size());
+
+    // 2.3. Store the non active part of the pivot column and the
+    // pivot column above the pivot to U
+    HighsInt end_N = mc_start[jColPivot] + mc_space[jColPivot];
+    HighsInt start_N = end_N - mc_count_n[jColPivot];
+    for (HighsInt i = start_N; i < end_N; i++) {
+      u_index.push_back(mc_index[i]);
+      u_value.push_back(mc_value[i]);
+    }
+    for (HighsInt i = 0; i < k; i++) {
+      if (pivot_col[i] == 0) continue;
+      u_index.push_back(dense_row[i]);
+      u_value.push_back(pivot_col[i]);
+    }
+    u_pivot_index.push_back(iRowPivot);
+    u_pivot_value.push_back(pivot_multiplier);
+    u_start.push_back(u_index.size());
+
+    // 2.4. Update the remaining columns, dropping tiny values as
+    // cancellation, and find the largest remaining entry in each
+    auto updateColumns = [&](HighsInt from_j, HighsInt to_j) {
+      for (HighsInt j = from_j; j < to_j; j++) {
+        double* col = &dense[size_t(j) * dense_num_row];
+        const double my_pivot = col[k];
+        double max_value = 0;
+        HighsInt max_position = k + 1;
+        for (HighsInt i = k + 1; i < dense_num_row; i++) {
+          if (my_pivot != 0) {
+            col[i] -= my_pivot * pivot_col[i];
+            if (fabs(col[i]) < kHighsTiny) col[i] = 0;
+          }
+          if (fabs(col[i]) > max_value) {
+            max_value = fabs(col[i]);
+            max_position = i;
+          }
+        }
+        col_max_value[j] = max_value;
+        col_max_position[j] = max_position;
+      }
+    };
+    const double update_work =
+        1.0 * (dense_num_col - k - 1) * (dense_num_row - k - 1);
+    if (parallel_elimination &&
+        dense_num_col - k - 1 > kBuildParallelGrainSize &&
+        update_work >= kBuildParallelMinWork) {
+      highs::parallel::for_each(k + 1, dense_num_col, updateColumns,
+                                kBuildParallelGrainSize);
+    } else {
+      updateColumns(k + 1, dense_num_col);
+    }
+    fake_eliminate += update_work;
+  }
+  build_synthetic_tick += fake_eliminate * 10;
+
+  // 3. Any columns without a pivot yield rank deficiency
+  rank_deficiency = dense_num_col - num_pivot;
+  if (rank_deficiency)
+    highsLogDev(log_options, HighsLogType::kWarning,
+                "Factorization identifies rank deficiency of %d\n",
+                (int)rank_deficiency);
+  return rank_deficiency;
+}
+
 void HFactor::buildHandleRankDeficiency() {
   debugReportRankDeficiency(0, highs_debug_level, log_options, num_row, permute,
                             iwork, basic_index, rank_deficiency,
@@ -1842,6 +2309,186 @@ void HFactor::btranU(HVector& rhs, const double expected_density,
   factor_timer.stop(FactorBtranUpper, factor_timer_clock_pointer);
 }
 
+// The sparse solves with L and U for a batch of vectors. Each column
+// (row) of the factor is applied to all vectors before moving on to
+// the next, so the factor is read once per batch rather than once per
+// vector. The operations on each vector are those - in the same order
+// - as in the sparse solves of ftranL, btranL, ftranU and btranU
+
+void HFactor::ftranLMulti(std::vector<HVector*>& vectors) const {
+  const HighsInt num_vector = vectors.size();
+  if (num_vector == 0) return;
+  // Alias to RHS
+  std::vector<HighsInt*> rhs_index(num_vector);
+  std::vector<double*> rhs_array(num_vector);
+  for (HighsInt iVec = 0; iVec < num_vector; iVec++) {
+    rhs_index[iVec] = vectors[iVec]->index.data();
+    rhs_array[iVec] = vectors[iVec]->array.data();
+  }
+  // Alias to factor L
+  const HighsInt* l_start = this->l_start.data();
+  const HighsInt* l_index = this->l_index.data();
+  const double* l_value = this->l_value.data();
+  // Local accumulation of RHS counts
+  std::vector<HighsInt> rhs_count(num_vector, 0);
+  // Transform
+  for (HighsInt i = 0; i < num_row; i++) {
+    const HighsInt pivotRow = l_pivot_index[i];
+    const HighsInt start = l_start[i];
+    const HighsInt end = l_start[i + 1];
+    for (HighsInt iVec = 0; iVec < num_vector; iVec++) {
+      double* array = rhs_array[iVec];
+      const double pivot_multiplier = array[pivotRow];
+      if (fabs(pivot_multiplier) > kHighsTiny) {
+        rhs_index[iVec][rhs_count[iVec]++] = pivotRow;
+        for (HighsInt k = start; k < end; k++)
+          array[l_index[k]] -= pivot_multiplier * l_value[k];
+      } else
+        array[pivotRow] = 0;
+    }
+  }
+  // Save the counts
+  for (HighsInt iVec = 0; iVec < num_vector; iVec++)
+    vectors[iVec]->count = rhs_count[iVec];
+}
+
+void HFactor::btranLMulti(std::vector<HVector*>& vectors) const {
+  const HighsInt num_vector = vectors.size();
+  if (num_vector == 0) return;
+  // Alias to RHS
+  std::vector<HighsInt*> rhs_index(num_vector);
+  std::vector<double*> rhs_array(num_vector);
+  for (HighsInt iVec = 0; iVec < num_vector; iVec++) {
+    rhs_index[iVec] = vectors[iVec]->index.data();
+    rhs_array[iVec] = vectors[iVec]->array.data();
+  }
+  // Alias to factor L
+  const HighsInt* lr_start = this->lr_start.data();
+  const HighsInt* lr_index = this->lr_index.data();
+  const double* lr_value = this->lr_value.data();
+  // Local accumulation of RHS counts
+  std::vector<HighsInt> rhs_count(num_vector, 0);
+  // Transform
+  for (HighsInt i = num_row - 1; i >= 0; i--) {
+    const HighsInt pivotRow = l_pivot_index[i];
+    const HighsInt start = lr_start[i];
+    const HighsInt end = lr_start[i + 1];
+    for (HighsInt iVec = 0; iVec < num_vector; iVec++) {
+      double* array = rhs_array[iVec];
+      const double pivot_multiplier = array[pivotRow];
+      if (fabs(pivot_multiplier) > kHighsTiny) {
+        rhs_index[iVec][rhs_count[iVec]++] = pivotRow;
+        for (HighsInt k = start; k < end; k++)
+          array[lr_index[k]] -= pivot_multiplier * lr_value[k];
+      } else
+        array[pivotRow] = 0;
+    }
+  }
+  // Save the counts
+  for (HighsInt iVec = 0; iVec < num_vector; iVec++)
+    vectors[iVec]->count = rhs_count[iVec];
+}
+
+void HFactor::ftranUMulti(std::vector<HVector*>& vectors) const {
+  const HighsInt num_vector = vectors.size();
+  if (num_vector == 0) return;
+  // Alias to RHS
+  std::vector<HighsInt*> rhs_index(num_vector);
+  std::vector<double*> rhs_array(num_vector);
+  for (HighsInt iVec = 0; iVec < num_vector; iVec++) {
+    rhs_index[iVec] = vectors[iVec]->index.data();
+    rhs_array[iVec] = vectors[iVec]->array.data();
+  }
+  // Alias to factor U
+  const HighsInt* u_start = this->u_start.data();
+  const HighsInt* u_end = this->u_last_p.data();
+  const HighsInt* u_index = this->u_index.data();
+  const double* u_value = this->u_value.data();
+  // Local accumulation of RHS counts and synthetic ticks
+  std::vector<HighsInt> rhs_count(num_vector, 0);
+  std::vector<double> rhs_synthetic_tick(num_vector, 0);
+  // Transform
+  HighsInt u_pivot_count = u_pivot_index.size();
+  for (HighsInt i_logic = u_pivot_count - 1; i_logic >= 0; i_logic--) {
+    // Skip void
+    if (u_pivot_index[i_logic] == -1) continue;
+    // Normal part
+    const HighsInt pivotRow = u_pivot_index[i_logic];
+    const double pivot_value = u_pivot_value[i_logic];
+    const HighsInt start = u_start[i_logic];
+    const HighsInt end = u_end[i_logic];
+    for (HighsInt iVec = 0; iVec < num_vector; iVec++) {
+      double* array = rhs_array[iVec];
+      double pivot_multiplier = array[pivotRow];
+      if (fabs(pivot_multiplier) > kHighsTiny) {
+        pivot_multiplier /= pivot_value;
+        rhs_index[iVec][rhs_count[iVec]++] = pivotRow;
+        array[pivotRow] = pivot_multiplier;
+        if (i_logic >= num_row) rhs_synthetic_tick[iVec] += (end - start);
+        for (HighsInt k = start; k < end; k++)
+          array[u_index[k]] -= pivot_multiplier * u_value[k];
+      } else
+        array[pivotRow] = 0;
+    }
+  }
+  // Save the counts and synthetic ticks
+  for (HighsInt iVec = 0; iVec < num_vector; iVec++) {
+    vectors[iVec]->count = rhs_count[iVec];
+    vectors[iVec]->synthetic_tick +=
+        rhs_synthetic_tick[iVec] * 15 + (u_pivot_count - num_row) * 10;
+  }
+}
+
+void HFactor::btranUMulti(std::vector<HVector*>& vectors) const {
+  const HighsInt num_vector = vectors.size();
+  if (num_vector == 0) return;
+  // Alias to RHS
+  std::vector<HighsInt*> rhs_index(num_vector);
+  std::vector<double*> rhs_array(num_vector);
+  for (HighsInt iVec = 0; iVec < num_vector; iVec++) {
+    rhs_index[iVec] = vectors[iVec]->index.data();
+    rhs_array[iVec] = vectors[iVec]->array.data();
+  }
+  // Alias to factor U
+  const HighsInt* ur_start = this->ur_start.data();
+  const HighsInt* ur_end = this->ur_lastp.data();
+  const HighsInt* ur_index = this->ur_index.data();
+  const double* ur_value = this->ur_value.data();
+  // Local accumulation of RHS counts and synthetic ticks
+  std::vector<HighsInt> rhs_count(num_vector, 0);
+  std::vector<double> rhs_synthetic_tick(num_vector, 0);
+  // Transform
+  HighsInt u_pivot_count = u_pivot_index.size();
+  for (HighsInt i_logic = 0; i_logic < u_pivot_count; i_logic++) {
+    // Skip void
+    if (u_pivot_index[i_logic] == -1) continue;
+    // Normal part
+    const HighsInt pivotRow = u_pivot_index[i_logic];
+    const double pivot_value = u_pivot_value[i_logic];
+    const HighsInt start = ur_start[i_logic];
+    const HighsInt end = ur_end[i_logic];
+    for (HighsInt iVec = 0; iVec < num_vector; iVec++) {
+      double* array = rhs_array[iVec];
+      double pivot_multiplier = array[pivotRow];
+      if (fabs(pivot_multiplier) > kHighsTiny) {
+        pivot_multiplier /= pivot_value;
+        rhs_index[iVec][rhs_count[iVec]++] = pivotRow;
+        array[pivotRow] = pivot_multiplier;
+        if (i_logic >= num_row) rhs_synthetic_tick[iVec] += (end - start);
+        for (HighsInt k = start; k < end; k++)
+          array[ur_index[k]] -= pivot_multiplier * ur_value[k];
+      } else
+        array[pivotRow] = 0;
+    }
+  }
+  // Save the counts and synthetic ticks
+  for (HighsInt iVec = 0; iVec < num_vector; iVec++) {
+    vectors[iVec]->count = rhs_count[iVec];
+    vectors[iVec]->synthetic_tick +=
+        rhs_synthetic_tick[iVec] * 15 + (u_pivot_count - num_row) * 10;
+  }
+}
+
 void HFactor::ftranFT(HVector& vector) const {
   // Alias to non constant
   assert(vector.count >= 0);
@@ -197,6 +197,28 @@ class HFactor {
   void btranCall(std::vector<double>& vector,
                  HighsTimerClock* factor_timer_clock_pointer = NULL);
 
+  /**
+   * @brief Solve \f$B\mathbf{x}=\mathbf{b}\f$ (FTRAN) for a batch of
+   * RHS, applying each column of L and U to all vectors that take a
+   * sparse (rather than hyper-sparse) solve in one sweep of the factor.
+   * The result for each vector is identical to that of ftranCall
+   */
+  void ftranMulti(
+      std::vector<HVector*>& vectors,  //!< RHS vectors
+      const std::vector<double>&
+          expected_density,  //!< Expected density of each result
+      HighsTimerClock* factor_timer_clock_pointer = NULL) const;
+
+  /**
+   * @brief Solve \f$B^T\mathbf{x}=\mathbf{b}\f$ (BTRAN) for a batch of
+   * RHS, as for ftranMulti
+   */
+  void btranMulti(
+      std::vector<HVector*>& vectors,  //!< RHS vectors
+      const std::vector<double>&
+          expected_density,  //!< Expected density of each result
+      HighsTimerClock* factor_timer_clock_pointer = NULL) const;
+
   /**
    * @brief Update according to
    * \f$B'=B+(\mathbf{a}_q-B\mathbf{e}_p)\mathbf{e}_p^T\f$
@@ -381,6 +403,7 @@ class HFactor {
   vector<HighsInt> mwz_column_index;
   vector<char> mwz_column_mark;
   vector<double> mwz_column_array;
+  vector<HighsInt> mwz_column_position;
 
   // Count link list
   vector<HighsInt> col_link_first;
@@ -432,6 +455,9 @@ class HFactor {
   void buildSimple();
   //    void buildKernel();
   HighsInt buildKernel();
+  double buildKernelParallelEliminate(const HighsInt iRowPivot,
+                                      const HighsInt mwz_column_count);
+  HighsInt buildKernelDense(const bool parallel_elimination);
   void buildHandleRankDeficiency();
   void buildReportRankDeficiency();
   void buildMarkSingC();
@@ -458,6 +484,11 @@ class HFactor {
   void btranU(HVector& vector, const double expected_density,
               HighsTimerClock* factor_timer_clock_pointer = NULL) const;
 
+  void ftranLMulti(std::vector<HVector*>& vectors) const;
+  void btranLMulti(std::vector<HVector*>& vectors) const;
+  void ftranUMulti(std::vector<HVector*>& vectors) const;
+  void btranUMulti(std::vector<HVector*>& vectors) const;
+
   void ftranFT(HVector& vector) const;
   void btranFT(HVector& vector) const;
   void ftranPF(HVector& vector) const;
@@ -79,6 +79,25 @@ const HighsInt kPFVectors = 2000;
 const HighsInt kPFEntriesMultiplier = 4;
 const HighsInt kNewLRRowsExtraNz = 100;
 
+/**
+ * Parameters for the parallel elimination in the Markowitz kernel:
+ * the columns of the pivot row are updated concurrently when the
+ * product of the pivot row and column counts is at least the minimal
+ * work, in blocks of at least the grain size
+ */
+const double kBuildParallelMinWork = 1e4;
+const HighsInt kBuildParallelGrainSize = 16;
+
+/**
+ * Parameters for switching from Markowitz pivoting to a dense
+ * factorization of the remaining kernel: its dimensions must be in
+ * the given range, and every column must have at least the given
+ * fraction of the active rows as entries
+ */
+const HighsInt kDenseKernelMinDim = 50;
+const HighsInt kDenseKernelMaxDim = 4000;
+const double kDenseKernelMinDensity = 0.3;
+
 enum ReportLuOption { kReportLuJustL = 1, kReportLuJustU, kReportLuBoth };
 
 #endif /* HFACTORCONST_H_ */
@@ -81,6 +81,13 @@ class HighsDataStack {
   void setPosition(size_t position_) { this->position = position_; }
 
   size_t getCurrentDataSize() const { return data.size(); }
+
+  const std::vector<char>& getData() const { return data; }
+
+  void setData(std::vector<char>&& data_) {
+    data = std::move(data_);
+    resetPosition();
+  }
 };
 
 #endif
@@ -1197,7 +1197,8 @@ class HighsHashTree {
   static NodePtr copy_recurse(NodePtr node) {
     switch (node.getType()) {
       case kEmpty:
-        throw std::logic_error("Unexpected node type in empty in hash tree");
+        // only the root of an empty tree has this type
+        return node;
       case kListLeaf: {
         ListLeaf* leaf = node.getListLeaf();
 
@@ -1205,11 +1206,11 @@ class HighsHashTree {
 
         ListNode* iter = &leaf->first;
         ListNode* copyIter = &copyLeaf->first;
-        do {
+        while (iter->next != nullptr) {
           copyIter->next = new ListNode(*iter->next);
           iter = iter->next;
           copyIter = copyIter->next;
-        } while (iter->next != nullptr);
+        }
 
         return copyLeaf;
       }
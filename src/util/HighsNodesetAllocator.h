@@ -0,0 +1,145 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2024 by Julian Hall, Ivet Galabova,    */
+/*    Leona Gottwald and Michael Feldmeier                               */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file util/HighsNodesetAllocator.h
+ * @brief Allocator for the nodes of node based containers such as std::set
+ * that takes single nodes from chunks shared by all allocators with the same
+ * state, and releases the chunks together when the state is destroyed
+ */
+#ifndef UTIL_HIGHS_NODESET_ALLOCATOR_H_
+#define UTIL_HIGHS_NODESET_ALLOCATOR_H_
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+
+template <int S>
+struct HighsNodesetChunkWithSize {
+  HighsNodesetChunkWithSize* next;
+  typename std::aligned_storage<S, alignof(std::max_align_t)>::type storage;
+};
+
+using HighsNodesetChunk = HighsNodesetChunkWithSize<
+    4096 - offsetof(HighsNodesetChunkWithSize<sizeof(void*)>, storage)>;
+
+struct HighsNodesetAllocatorState {
+  void* freeListHead = nullptr;
+  char* currChunkStart = nullptr;
+  char* currChunkEnd = nullptr;
+  HighsNodesetChunk* chunkListHead = nullptr;
+
+  HighsNodesetAllocatorState() = default;
+  HighsNodesetAllocatorState(const HighsNodesetAllocatorState&) = delete;
+  HighsNodesetAllocatorState(HighsNodesetAllocatorState&& other)
+      : freeListHead(other.freeListHead),
+        currChunkStart(other.currChunkStart),
+        currChunkEnd(other.currChunkEnd),
+        chunkListHead(other.chunkListHead) {
+    other.chunkListHead = nullptr;
+  }
+
+  HighsNodesetAllocatorState& operator=(const HighsNodesetAllocatorState&) =
+      delete;
+
+  HighsNodesetAllocatorState& operator=(HighsNodesetAllocatorState&& other) {
+    freeListHead = other.freeListHead;
+    currChunkStart = other.currChunkStart;
+    currChunkEnd = other.currChunkEnd;
+    chunkListHead = other.chunkListHead;
+
+    other.chunkListHead = nullptr;
+    return *this;
+  }
+
+  ~HighsNodesetAllocatorState() {
+    while (chunkListHead) {
+      HighsNodesetChunk* delChunk = chunkListHead;
+      chunkListHead = delChunk->next;
+      delete delChunk;
+    }
+  }
+};
+
+template <typename T>
+class HighsNodesetAllocator {
+  union FreelistNode {
+    FreelistNode* next;
+    typename std::aligned_storage<sizeof(T), alignof(T)>::type storage;
+  };
+
+ public:
+  HighsNodesetAllocatorState* state;
+  using value_type = T;
+  using size_type = std::size_t;
+  using propagate_on_container_move_assignment = std::true_type;
+
+  HighsNodesetAllocator(HighsNodesetAllocatorState* state) : state(state) {}
+  HighsNodesetAllocator(const HighsNodesetAllocator& other) noexcept = default;
+  template <typename U>
+  HighsNodesetAllocator(const HighsNodesetAllocator<U>& other) noexcept
+      : state(other.state) {}
+  HighsNodesetAllocator(HighsNodesetAllocator&& other) noexcept = default;
+  HighsNodesetAllocator& operator=(const HighsNodesetAllocator&) noexcept =
+      default;
+  HighsNodesetAllocator& operator=(HighsNodesetAllocator&& other) noexcept =
+      default;
+  ~HighsNodesetAllocator() noexcept = default;
+
+  T* allocate(size_type n) {
+    if (n == 1) {
+      T* ptr = reinterpret_cast<T*>(state->freeListHead);
+      if (ptr) {
+        state->freeListHead =
+            reinterpret_cast<FreelistNode*>(state->freeListHead)->next;
+      } else {
+        ptr = reinterpret_cast<T*>(state->currChunkStart);
+        state->currChunkStart += sizeof(FreelistNode);
+        if (state->currChunkStart > state->currChunkEnd) {
+          auto newChunk = new HighsNodesetChunk;
+          newChunk->next = state->chunkListHead;
+          state->chunkListHead = newChunk;
+          state->currChunkStart = reinterpret_cast<char*>(&newChunk->storage);
+          state->currChunkEnd =
+              state->currChunkStart + sizeof(newChunk->storage);
+          ptr = reinterpret_cast<T*>(state->currChunkStart);
+          state->currChunkStart += sizeof(FreelistNode);
+        }
+      }
+      return ptr;
+    }
+
+    return static_cast<T*>(::operator new(n * sizeof(T)));
+  }
+
+  void deallocate(T* ptr, size_type n) noexcept {
+    if (n == 1) {
+      FreelistNode* node = reinterpret_cast<FreelistNode*>(ptr);
+      node->next = reinterpret_cast<FreelistNode*>(state->freeListHead);
+      state->freeListHead = node;
+    } else {
+      ::operator delete(ptr);
+    }
+  }
+};
+
+template <typename T, typename U>
+bool operator==(const HighsNodesetAllocator<T>&,
+                const HighsNodesetAllocator<U>&) {
+  return true;
+}
+
+template <typename T, typename U>
+bool operator!=(const HighsNodesetAllocator<T>&,
+                const HighsNodesetAllocator<U>&) {
+  return false;
+}
+
+#endif
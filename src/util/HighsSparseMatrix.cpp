@@ -17,6 +17,7 @@
 #include <cassert>
 #include <cmath>
 
+#include "parallel/HighsParallel.h"
 #include "util/HighsCDouble.h"
 #include "util/HighsMatrixUtils.h"
 #include "util/HighsSort.h"
@@ -1473,6 +1474,111 @@ void HighsSparseMatrix::priceByRowWithSwitch(
   }
 }
 
+void HighsSparseMatrix::priceByColumnParallel(
+    HVector& result, const HVector& column,
+    std::vector<HVector>& partial_result) const {
+  assert(this->isColwise());
+  // The columns are split into one chunk for each partial result,
+  // whose index array accumulates the nonzeros in the chunk. Each
+  // value is formed as in priceByColumn, and the chunks' nonzeros are
+  // joined in order, so the result is identical to that of
+  // priceByColumn
+  const HighsInt num_chunk = partial_result.size();
+  highs::parallel::for_each(0, num_chunk, [&](HighsInt start, HighsInt end) {
+    for (HighsInt iChunk = start; iChunk < end; iChunk++) {
+      HVector& partial = partial_result[iChunk];
+      const HighsInt from_col = (int64_t)iChunk * this->num_col_ / num_chunk;
+      const HighsInt to_col =
+          (int64_t)(iChunk + 1) * this->num_col_ / num_chunk;
+      partial.count = 0;
+      for (HighsInt iCol = from_col; iCol < to_col; iCol++) {
+        double value = 0;
+        for (HighsInt iEl = this->start_[iCol]; iEl < this->start_[iCol + 1];
+             iEl++)
+          value += column.array[this->index_[iEl]] * this->value_[iEl];
+        if (fabs(value) > kHighsTiny) {
+          result.array[iCol] = value;
+          partial.index[partial.count++] = iCol;
+        }
+      }
+    }
+  });
+  result.count = 0;
+  for (HighsInt iChunk = 0; iChunk < num_chunk; iChunk++) {
+    const HVector& partial = partial_result[iChunk];
+    for (HighsInt iX = 0; iX < partial.count; iX++)
+      result.index[result.count++] = partial.index[iX];
+  }
+}
+
+void HighsSparseMatrix::priceByRowParallel(
+    HVector& result, const HVector& column,
+    std::vector<HVector>& partial_result) const {
+  assert(this->isRowwise());
+  // The nonzeros of column are split into one chunk for each partial
+  // result, whose array accumulates the contributions from the chunk
+  // as in priceByRowDenseResult. The partial results are then summed
+  // in chunk order, so the result is independent of the scheduling of
+  // the tasks. The arrays of the partial results are assumed to be
+  // zero on entry, and are zero on return
+  const HighsInt num_chunk = partial_result.size();
+  highs::parallel::for_each(0, num_chunk, [&](HighsInt start, HighsInt end) {
+    for (HighsInt iChunk = start; iChunk < end; iChunk++) {
+      std::vector<double>& partial_array = partial_result[iChunk].array;
+      const HighsInt from_index = (int64_t)iChunk * column.count / num_chunk;
+      const HighsInt to_index =
+          (int64_t)(iChunk + 1) * column.count / num_chunk;
+      for (HighsInt ix = from_index; ix < to_index; ix++) {
+        HighsInt iRow = column.index[ix];
+        double multiplier = column.array[iRow];
+        HighsInt to_iEl;
+        if (this->format_ == MatrixFormat::kRowwisePartitioned) {
+          to_iEl = this->p_end_[iRow];
+        } else {
+          to_iEl = this->start_[iRow + 1];
+        }
+        for (HighsInt iEl = this->start_[iRow]; iEl < to_iEl; iEl++) {
+          HighsInt iCol = this->index_[iEl];
+          double value0 = partial_array[iCol];
+          double value1 = value0 + multiplier * this->value_[iEl];
+          partial_array[iCol] =
+              (fabs(value1) < kHighsTiny) ? kHighsZero : value1;
+        }
+      }
+    }
+  });
+  // Sum the partial results over chunks of the columns, accumulating
+  // the nonzeros in each chunk in the index array of the
+  // corresponding partial result
+  highs::parallel::for_each(0, num_chunk, [&](HighsInt start, HighsInt end) {
+    for (HighsInt iChunk = start; iChunk < end; iChunk++) {
+      HVector& partial = partial_result[iChunk];
+      const HighsInt from_col = (int64_t)iChunk * this->num_col_ / num_chunk;
+      const HighsInt to_col =
+          (int64_t)(iChunk + 1) * this->num_col_ / num_chunk;
+      partial.count = 0;
+      for (HighsInt iCol = from_col; iCol < to_col; iCol++) {
+        double value = 0;
+        for (HighsInt jChunk = 0; jChunk < num_chunk; jChunk++) {
+          double& partial_value = partial_result[jChunk].array[iCol];
+          value += partial_value;
+          partial_value = 0;
+        }
+        if (fabs(value) >= kHighsTiny) {
+          result.array[iCol] = value;
+          partial.index[partial.count++] = iCol;
+        }
+      }
+    }
+  });
+  result.count = 0;
+  for (HighsInt iChunk = 0; iChunk < num_chunk; iChunk++) {
+    const HVector& partial = partial_result[iChunk];
+    for (HighsInt iX = 0; iX < partial.count; iX++)
+      result.index[result.count++] = partial.index[iX];
+  }
+}
+
 void HighsSparseMatrix::update(const HighsInt var_in, const HighsInt var_out,
                                const HighsSparseMatrix& matrix) {
   assert(matrix.format_ == MatrixFormat::kColwise);
@@ -113,6 +113,14 @@ class HighsSparseMatrix {
       const double expected_density, const HighsInt from_index,
       const double switch_density,
       const HighsInt debug_report = kDebugReportOff) const;
+  // Parallel PRICE, using one task for each of the (set up) vectors
+  // in partial_result. The column-wise result is identical to that of
+  // priceByColumn, whereas the row-wise result depends on the number
+  // of partial results
+  void priceByColumnParallel(HVector& result, const HVector& column,
+                             std::vector<HVector>& partial_result) const;
+  void priceByRowParallel(HVector& result, const HVector& column,
+                          std::vector<HVector>& partial_result) const;
   void update(const HighsInt var_in, const HighsInt var_out,
               const HighsSparseMatrix& matrix);
   double computeDot(const HVector& column, const HighsInt use_col) const {